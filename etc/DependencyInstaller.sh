@@ -360,6 +360,7 @@ _installUbuntuPackages() {
         libffi-dev \
         libfl-dev \
         libgomp1 \
+        liblz4-dev \
         libomp-dev \
         libpcre2-dev \
         libpcre3-dev \
@@ -439,6 +440,7 @@ _installRHELPackages() {
         llvm \
         llvm-devel \
         llvm-libs \
+        lz4-devel \
         make \
         pcre-devel \
         pcre2-devel \
@@ -498,6 +500,7 @@ _installOpenSusePackages() {
         libqt5-qtbase \
         libqt5-qtstyleplugins \
         libstdc++6-devel-gcc8 \
+        liblz4-devel \
         llvm \
         pandoc \
         pcre-devel \
@@ -554,7 +557,7 @@ Then, rerun this script.
 EOF
         exit 1
     fi
-    brew install bison boost cmake eigen flex fmt groff libomp or-tools pandoc pyqt5 python spdlog tcl-tk zlib
+    brew install bison boost cmake eigen flex fmt groff libomp lz4 or-tools pandoc pyqt5 python spdlog tcl-tk zlib
 
     # Some systems need this to correctly find OpenMP package during build
     brew link --force libomp
@@ -598,6 +601,7 @@ _installDebianPackages() {
         libffi-dev \
         libfl-dev \
         libgomp1 \
+        liblz4-dev \
         libomp-dev \
         libpcre2-dev \
         libpcre3-dev \
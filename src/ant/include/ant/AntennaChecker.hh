@@ -4,12 +4,15 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
+#include <unordered_map>
 
 #include "ant/GlobalRouteSource.hh"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/dbWireGraph.h"
 #include "utl/Logger.h"
 
@@ -24,6 +27,7 @@ using utl::Logger;
 struct PARinfo;
 struct ARinfo;
 struct AntennaModel;
+class AntennaDbCbk;
 
 ///////////////////////////////////////
 struct GraphNode;
@@ -129,6 +133,8 @@ class AntennaChecker
 
  private:
   bool haveRoutedNets();
+  void initDbCallbacks();
+  void invalidateNet(odb::dbNet* net);
   double getPwlFactor(odb::dbTechLayerAntennaRule::pwl_pair pwl_info,
                       double ref_val,
                       double def);
@@ -209,8 +215,47 @@ class AntennaChecker
   std::vector<odb::dbNet*> nets_;
   std::map<odb::dbNet*, ViolationReport> net_to_report_;
   std::mutex map_mutex_;
+  // Pin violation count of each net whose report in net_to_report_ is still
+  // valid. Nets are removed by db_cbk_ when their wires or gates change, so
+  // a full check only recomputes the modified nets.
+  std::unordered_map<odb::dbNet*, int> net_pin_violations_;
+  bool cached_verbose_{false};
+  // Set while the checker makes and destroys its global route wires.
+  bool invalidation_suspended_{false};
+  std::unique_ptr<AntennaDbCbk> db_cbk_;
+  odb::dbBlock* db_cbk_block_{nullptr};
   // consts
   static constexpr int max_diode_count_per_gate = 10;
+
+  friend class AntennaDbCbk;
+};
+
+// Invalidates the cached antenna results of nets modified in the db.
+class AntennaDbCbk : public odb::dbBlockCallBackObj
+{
+ public:
+  AntennaDbCbk(AntennaChecker* checker);
+  void inDbPostMoveInst(odb::dbInst* inst) override;
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
+
+  void inDbNetDestroy(odb::dbNet* net) override;
+
+  void inDbITermPostDisconnect(odb::dbITerm* iterm, odb::dbNet* net) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePostDetach(odb::dbWire* wire, odb::dbNet* net) override;
+  void inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst) override;
+
+ private:
+  void instItermsDirty(odb::dbInst* inst);
+  void wireDirty(odb::dbWire* wire);
+
+  AntennaChecker* checker_;
 };
 
 }  // namespace ant
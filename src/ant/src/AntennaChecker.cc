@@ -24,6 +24,7 @@
 #include "odb/dbShape.h"
 #include "odb/dbTypes.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 namespace ant {
 
@@ -59,7 +60,11 @@ extern "C" {
 extern int Ant_Init(Tcl_Interp* interp);
 }
 
-AntennaChecker::AntennaChecker() = default;
+AntennaChecker::AntennaChecker()
+    : db_cbk_(std::make_unique<AntennaDbCbk>(this))
+{
+}
+
 AntennaChecker::~AntennaChecker() = default;
 
 void AntennaChecker::init(odb::dbDatabase* db,
@@ -1045,10 +1050,8 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
                                   const int num_threads,
                                   bool verbose)
 {
-  {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    net_to_report_.clear();
-  }
+  const utl::DebugScopedTimer timer(
+      logger_, ANT, "timer", 1, "Check antennas: {}");
   initAntennaRules();
 
   std::ofstream report_file;
@@ -1069,8 +1072,30 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
                    "detailed_route first.");
   }
 
+  if (!db_cbk_->hasOwner()) {
+    // Destroying a block removes its callbacks.
+    db_cbk_block_ = nullptr;
+  }
+  // Results of unmodified nets are reused only by full checks of detailed
+  // routes with the same report verbosity on the same block. Global routes
+  // change without db callbacks, so their results are never kept.
+  const bool reuse_results = net == nullptr && verbose == cached_verbose_
+                             && db_cbk_block_ == block_ && !use_grt_routes;
+  {
+    std::lock_guard<std::mutex> lock(map_mutex_);
+    if (!reuse_results) {
+      net_to_report_.clear();
+      net_pin_violations_.clear();
+    }
+  }
+  cached_verbose_ = verbose;
+  initDbCallbacks();
+
   if (use_grt_routes) {
+    // The temporary global route wires must not invalidate the cache.
+    invalidation_suspended_ = true;
     global_route_source_->makeNetWires();
+    invalidation_suspended_ = false;
   }
 
   int net_violation_count = 0;
@@ -1090,20 +1115,39 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
     }
   } else {
     nets_.clear();
+    std::vector<odb::dbNet*> modified_nets;
     for (odb::dbNet* net : block_->getNets()) {
       if (!net->isSpecial()) {
         nets_.push_back(net);
+        if (net_pin_violations_.find(net) == net_pin_violations_.end()) {
+          net_to_report_[net] = ViolationReport();
+          modified_nets.push_back(net);
+        }
       }
     }
+    std::vector<int> pin_viol_counts(modified_nets.size());
     omp_set_num_threads(num_threads);
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < nets_.size(); i++) {
-      odb::dbNet* net = nets_[i];
+    for (int i = 0; i < modified_nets.size(); i++) {
+      odb::dbNet* net = modified_nets[i];
       Violations antenna_violations;
-      int pin_viol_count
+      pin_viol_counts[i]
           = checkNet(net, verbose, true, nullptr, 0, antenna_violations);
+    }
+    for (int i = 0; i < modified_nets.size(); i++) {
+      net_pin_violations_[modified_nets[i]] = pin_viol_counts[i];
+    }
+    debugPrint(logger_,
+               ANT,
+               "check",
+               1,
+               "Checked {} nets, reused the results of {} nets.",
+               modified_nets.size(),
+               nets_.size() - modified_nets.size());
+
+    for (odb::dbNet* net : nets_) {
+      const int pin_viol_count = net_pin_violations_.at(net);
       if (pin_viol_count > 0) {
-        std::lock_guard<std::mutex> lock(map_mutex_);
         net_violation_count++;
         pin_violation_count += pin_viol_count;
       }
@@ -1125,7 +1169,10 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
   }
 
   if (use_grt_routes) {
+    invalidation_suspended_ = true;
     global_route_source_->destroyNetWires();
+    invalidation_suspended_ = false;
+    net_pin_violations_.clear();
   }
 
   net_violation_count_ = net_violation_count;
@@ -1137,6 +1184,23 @@ int AntennaChecker::antennaViolationCount() const
   return net_violation_count_;
 }
 
+void AntennaChecker::initDbCallbacks()
+{
+  if (db_cbk_block_ == block_) {
+    return;
+  }
+  db_cbk_->removeOwner();
+  db_cbk_->addOwner(block_);
+  db_cbk_block_ = block_;
+}
+
+void AntennaChecker::invalidateNet(odb::dbNet* net)
+{
+  if (net != nullptr && !invalidation_suspended_) {
+    net_pin_violations_.erase(net);
+  }
+}
+
 bool AntennaChecker::haveRoutedNets()
 {
   for (odb::dbNet* net : block_->getNets()) {
@@ -1164,4 +1228,85 @@ void AntennaChecker::setReportFileName(const char* file_name)
   report_file_name_ = file_name;
 }
 
+////////////////////////////////////////////////////////////////
+
+AntennaDbCbk::AntennaDbCbk(AntennaChecker* checker) : checker_(checker)
+{
+}
+
+void AntennaDbCbk::inDbPostMoveInst(odb::dbInst* inst)
+{
+  instItermsDirty(inst);
+}
+
+void AntennaDbCbk::inDbInstSwapMasterAfter(odb::dbInst* inst)
+{
+  instItermsDirty(inst);
+}
+
+void AntennaDbCbk::instItermsDirty(odb::dbInst* inst)
+{
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    checker_->invalidateNet(iterm->getNet());
+  }
+}
+
+void AntennaDbCbk::inDbNetDestroy(odb::dbNet* net)
+{
+  checker_->invalidateNet(net);
+  std::lock_guard<std::mutex> lock(checker_->map_mutex_);
+  checker_->net_to_report_.erase(net);
+}
+
+void AntennaDbCbk::inDbITermPostDisconnect(odb::dbITerm* iterm,
+                                           odb::dbNet* net)
+{
+  checker_->invalidateNet(net);
+}
+
+void AntennaDbCbk::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  checker_->invalidateNet(iterm->getNet());
+}
+
+void AntennaDbCbk::inDbWireCreate(odb::dbWire* wire)
+{
+  wireDirty(wire);
+}
+
+void AntennaDbCbk::inDbWireDestroy(odb::dbWire* wire)
+{
+  wireDirty(wire);
+}
+
+void AntennaDbCbk::inDbWirePostModify(odb::dbWire* wire)
+{
+  wireDirty(wire);
+}
+
+void AntennaDbCbk::inDbWirePostAttach(odb::dbWire* wire)
+{
+  wireDirty(wire);
+}
+
+void AntennaDbCbk::inDbWirePostDetach(odb::dbWire* wire, odb::dbNet* net)
+{
+  checker_->invalidateNet(net);
+}
+
+void AntennaDbCbk::inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst)
+{
+  wireDirty(dst);
+}
+
+void AntennaDbCbk::inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst)
+{
+  wireDirty(dst);
+}
+
+void AntennaDbCbk::wireDirty(odb::dbWire* wire)
+{
+  checker_->invalidateNet(wire->getNet());
+}
+
 }  // namespace ant
@@ -0,0 +1,17 @@
+source "helpers.tcl"
+# check_antennas reuses the results of nets that did not change
+read_lef merged_spacing.lef
+read_def sw130_random.def
+
+set_debug_level ANT check 1
+check_antennas
+check_antennas
+puts "violation count = [ant::antenna_violation_count]"
+
+# Moving an instance (here away and back) rechecks the nets connected to it
+set inst [[ord::get_db_block] findInst output51]
+lassign [$inst getLocation] x y
+$inst setLocation [expr $x + 480] $y
+$inst setLocation $x $y
+check_antennas
+puts "violation count = [ant::antenna_violation_count]"
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <set>
 
 #include "odb/db.h"
@@ -216,6 +219,8 @@ class dbNetwork : public ConcreteNetwork
   bool findRelatedModNet(const dbNet*, std::set<dbModNet*>& modnet_set) const;
   dbNet* findRelatedDbNet(const dbModNet*) const;
   dbModNet* findModNetForPin(const Pin*);
+  // Called on any netlist edit that may change the flat net of a dbModNet.
+  void invalidateRelatedDbNets();
   dbModNet* findRelatedModNet(const dbNet*) const;
 
   ////////////////////////////////////////////////////////////////
@@ -382,9 +387,24 @@ class dbNetwork : public ConcreteNetwork
   static constexpr unsigned DBIDTAG_WIDTH = 0x4;
 
  private:
+  // Flat net of a dbModNet as found by findRelatedDbNet.  An entry is
+  // current only while its stamp matches related_db_net_stamp_.  STA
+  // threads fill entries concurrently without locking, so both fields
+  // are atomic; every writer for a given stamp stores the same net.
+  struct RelatedDbNet
+  {
+    std::atomic<unsigned> stamp{0};
+    std::atomic<dbNet*> net{nullptr};
+  };
+
   bool hierarchy_ = false;
   std::set<const Cell*> concrete_cells_;
   std::set<const Port*> concrete_ports_;
+  // Indexed by dbModNet id.  Only resized and restamped by netlist edits,
+  // which never run concurrently with timing queries.
+  std::unique_ptr<RelatedDbNet[]> related_db_nets_;
+  size_t related_db_nets_size_ = 0;
+  unsigned related_db_net_stamp_ = 1;
 };
 
 }  // namespace sta
@@ -1623,51 +1623,24 @@ Instance* dbNetwork::instance(const Net*) const
 
 bool dbNetwork::isPower(const Net* net) const
 {
-  dbNet* dnet = staToDb(net);
-  return (dnet->getSigType() == dbSigType::POWER);
-
-  /*
-  // TODO: make this work for modnets
-  // by uncommenting code below
-
   dbNet* db_net;
   dbModNet* db_modnet;
   staToDb(net, db_net, db_modnet);
-  if (db_net) {
-    return (db_net->getSigType() == dbSigType::POWER);
-  }
   if (db_modnet) {
-    dbNet* related_net = findRelatedDbNet(db_modnet);
-    if (related_net) {
-      return (related_net->getSigType() == dbSigType::POWER);
-    }
+    db_net = findRelatedDbNet(db_modnet);
   }
-  return false;
-  */
+  return db_net && db_net->getSigType() == dbSigType::POWER;
 }
 
 bool dbNetwork::isGround(const Net* net) const
 {
-  dbNet* dnet = staToDb(net);
-  return (dnet->getSigType() == dbSigType::GROUND);
-  /*
-  // TODO: make this work for modnets
-  // by uncommenting code below
-
   dbNet* db_net;
   dbModNet* db_modnet;
   staToDb(net, db_net, db_modnet);
-  if (db_net) {
-    return (db_net->getSigType() == dbSigType::GROUND);
-  }
   if (db_modnet) {
-    dbNet* related_net = findRelatedDbNet(db_modnet);
-    if (related_net) {
-      return (related_net->getSigType() == dbSigType::GROUND);
-    }
+    db_net = findRelatedDbNet(db_modnet);
   }
-  return false;
-  */
+  return db_net && db_net->getSigType() == dbSigType::GROUND;
 }
 
 NetPinIterator* dbNetwork::pinIterator(const Net* net) const
@@ -2008,6 +1981,7 @@ void dbNetwork::makeCell(Library* library, dbMaster* master)
 
 void dbNetwork::readDbNetlistAfter()
 {
+  invalidateRelatedDbNets();
   makeTopCell();
   findConstantNets();
   checkLibertyCorners();
@@ -2377,6 +2351,7 @@ Pin* dbNetwork::connect(Instance* inst, Port* port, Net* net)
 // Incrementally update drivers.
 void dbNetwork::connectPinAfter(Pin* pin)
 {
+  invalidateRelatedDbNets();
   if (isDriver(pin)) {
     Net* net = this->net(pin);
     PinSet* drvrs = net_drvr_pin_map_.findKey(net);
@@ -2475,6 +2450,7 @@ void dbNetwork::disconnectPin(Pin* pin)
 
 void dbNetwork::disconnectPinBefore(const Pin* pin)
 {
+  invalidateRelatedDbNets();
   Net* net = this->net(pin);
   // Incrementally update drivers.
   if (net && isDriver(pin)) {
@@ -2542,6 +2518,7 @@ void dbNetwork::deleteNet(Net* net)
 
 void dbNetwork::deleteNetBefore(const Net* net)
 {
+  invalidateRelatedDbNets();
   PinSet* drvrs = net_drvr_pin_map_.findKey(net);
   delete drvrs;
   net_drvr_pin_map_.erase(net);
@@ -3934,14 +3911,50 @@ bool dbNetwork::findRelatedModNet(const dbNet* net,
 
 /*
 A modnet can have only one equivalent dbNet.
+
+Finding it walks the whole hierarchical net, so the result is kept
+in related_db_nets_ until the next netlist edit.
 */
 dbNet* dbNetwork::findRelatedDbNet(const dbModNet* net) const
 {
+  const unsigned id = net->getId();
+  RelatedDbNet* entry
+      = id < related_db_nets_size_ ? &related_db_nets_[id] : nullptr;
+  if (entry
+      && entry->stamp.load(std::memory_order_acquire)
+             == related_db_net_stamp_) {
+    return entry->net.load(std::memory_order_relaxed);
+  }
+
   // we pass in the net and decode it for axiom checking.
   PinModDbNetConnection visitor(this, logger_, dbToSta(net));
   NetSet visited_nets(this);
   visitConnectedPins(dbToSta(net), visitor, visited_nets);
-  return visitor.getNet();
+  dbNet* related_net = visitor.getNet();
+
+  if (entry) {
+    entry->net.store(related_net, std::memory_order_relaxed);
+    entry->stamp.store(related_db_net_stamp_, std::memory_order_release);
+  }
+  return related_net;
+}
+
+// Called from the odb callbacks on any edit that may change the flat net
+// of a dbModNet.  Also grows the table to cover modnets created since the
+// last edit.
+void dbNetwork::invalidateRelatedDbNets()
+{
+  related_db_net_stamp_++;
+  if (block_ == nullptr) {
+    return;
+  }
+  const size_t size = block_->getModNets().sequential() + 1;
+  if (size > related_db_nets_size_) {
+    // Old entries are stale after the stamp change, so nothing is copied.
+    related_db_nets_size_ = std::max(size, related_db_nets_size_ * 2);
+    related_db_nets_
+        = std::make_unique<RelatedDbNet[]>(related_db_nets_size_);
+  }
 }
 
 /*
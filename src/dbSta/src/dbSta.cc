@@ -159,13 +159,18 @@ class dbStaCbk : public dbBlockCallBackObj
   void inDbNetDestroy(dbNet* net) override;
   void inDbITermPostConnect(dbITerm* iterm) override;
   void inDbITermPreDisconnect(dbITerm* iterm) override;
+  void inDbITermPostDisconnect(dbITerm* iterm, dbNet* net) override;
   void inDbITermDestroy(dbITerm* iterm) override;
   void inDbBTermPostConnect(dbBTerm* bterm) override;
   void inDbBTermPreDisconnect(dbBTerm* bterm) override;
+  void inDbBTermPostDisConnect(dbBTerm* bterm, dbNet* net) override;
   void inDbBTermCreate(dbBTerm*) override;
   void inDbBTermDestroy(dbBTerm* bterm) override;
   void inDbBTermSetIoType(dbBTerm* bterm, const dbIoType& io_type) override;
   void inDbBTermSetSigType(dbBTerm* bterm, const dbSigType& sig_type) override;
+  void inDbModNetDestroy(dbModNet* modnet) override;
+  void inDbModNetPostDisconnect(dbModNet* modnet) override;
+  void inDbModNetPostConnect(dbModNet* modnet) override;
 
  private:
   dbSta* sta_;
@@ -958,6 +963,11 @@ void dbStaCbk::inDbITermPreDisconnect(dbITerm* iterm)
   network_->disconnectPinBefore(pin);
 }
 
+void dbStaCbk::inDbITermPostDisconnect(dbITerm*, dbNet*)
+{
+  network_->invalidateRelatedDbNets();
+}
+
 void dbStaCbk::inDbITermDestroy(dbITerm* iterm)
 {
   sta_->deletePinBefore(network_->dbToSta(iterm));
@@ -977,6 +987,11 @@ void dbStaCbk::inDbBTermPreDisconnect(dbBTerm* bterm)
   network_->disconnectPinBefore(pin);
 }
 
+void dbStaCbk::inDbBTermPostDisConnect(dbBTerm*, dbNet*)
+{
+  network_->invalidateRelatedDbNets();
+}
+
 void dbStaCbk::inDbBTermCreate(dbBTerm* bterm)
 {
   sta_->getDbNetwork()->makeTopPort(bterm);
@@ -1005,6 +1020,21 @@ void dbStaCbk::inDbBTermSetSigType(dbBTerm* bterm, const dbSigType& sig_type)
   bterm->staSetVertexId(object_id_null);
 }
 
+void dbStaCbk::inDbModNetDestroy(dbModNet*)
+{
+  network_->invalidateRelatedDbNets();
+}
+
+void dbStaCbk::inDbModNetPostDisconnect(dbModNet*)
+{
+  network_->invalidateRelatedDbNets();
+}
+
+void dbStaCbk::inDbModNetPostConnect(dbModNet*)
+{
+  network_->invalidateRelatedDbNets();
+}
+
 ////////////////////////////////////////////////////////////////
 
 BufferUseAnalyser::BufferUseAnalyser()
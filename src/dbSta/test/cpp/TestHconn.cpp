@@ -1053,4 +1053,27 @@ TEST_F(TestHconn, ConnectionMade)
             (num_mod_bterms_before_delete - num_mod_bterms_after_delete));
 }
 
+//
+// A hierarchical net takes its power and ground type from its flat net.
+//
+TEST_F(TestHconn, HierarchicalPowerNet)
+{
+  sta::Net* signal_net = db_network_->dbToSta(inv1_mod_i0_modnet);
+  sta::Net* supply_net = db_network_->dbToSta(inv1_mod_o0_modnet);
+  EXPECT_FALSE(db_network_->isPower(signal_net));
+  EXPECT_FALSE(db_network_->isGround(signal_net));
+  EXPECT_FALSE(db_network_->isPower(supply_net));
+  EXPECT_FALSE(db_network_->isGround(supply_net));
+
+  inv_op_net->setSigType(dbSigType::POWER);
+  EXPECT_TRUE(db_network_->isPower(supply_net));
+  EXPECT_FALSE(db_network_->isGround(supply_net));
+  EXPECT_FALSE(db_network_->isPower(signal_net));
+
+  inv_op_net->setSigType(dbSigType::GROUND);
+  EXPECT_FALSE(db_network_->isPower(supply_net));
+  EXPECT_TRUE(db_network_->isGround(supply_net));
+  EXPECT_FALSE(db_network_->isGround(signal_net));
+}
+
 }  // namespace odb
@@ -20,6 +20,7 @@
 #include "odb/util.h"
 #include "util/journal.h"
 #include "utl/Logger.h"
+#include "utl/tracer.h"
 
 namespace dpl {
 
@@ -92,6 +93,7 @@ void Opendp::detailedPlacement(const int max_displacement_x,
                                const int max_displacement_y,
                                const std::string& report_file_name)
 {
+  utl::TraceZone zone("DPL:detailedPlacement", "dpl");
   importDb();
   adjustNodesOrient();
   for (const auto& node : network_->getNodes()) {
@@ -216,6 +218,7 @@ void Opendp::findDisplacementStats()
 
 void Opendp::optimizeMirroring()
 {
+  utl::TraceZone zone("DPL:optimizeMirroring", "dpl");
   OptimizeMirroring opt(logger_, db_);
   opt.run();
 }
@@ -22,6 +22,7 @@
 #include "odb/dbTransform.h"
 #include "util/journal.h"
 #include "utl/Logger.h"
+#include "utl/tracer.h"
 // #define ODP_DEBUG
 
 namespace dpl {
@@ -48,6 +49,7 @@ std::string Opendp::printBgBox(
 }
 void Opendp::detailedPlacement()
 {
+  utl::TraceZone zone("DPL:place", "dpl");
   if (debug_observer_) {
     debug_observer_->startPlacement(block_);
   }
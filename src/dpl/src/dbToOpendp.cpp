@@ -20,6 +20,7 @@
 #include "odb/util.h"
 #include "util/symmetry.h"
 #include "utl/Logger.h"
+#include "utl/tracer.h"
 
 namespace dpl {
 
@@ -34,6 +35,7 @@ using odb::Rect;
 
 void Opendp::importDb()
 {
+  utl::TraceZone zone("DPL:importDb", "dpl");
   block_ = db_->getChip()->getBlock();
   core_ = block_->getCoreArea();
   grid_->setCore(core_);
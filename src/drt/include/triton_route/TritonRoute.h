@@ -163,13 +163,14 @@ class TritonRoute
                  const std::list<std::unique_ptr<frMarker>>& markers,
                  const std::string& marker_name,
                  odb::Rect drcBox = odb::Rect(0, 0, 0, 0)) const;
-  void checkDRC(const char* filename,
-                int x1,
-                int y1,
-                int x2,
-                int y2,
-                const std::string& marker_name,
-                int num_threads);
+  // Returns the number of violations found.
+  int checkDRC(const char* filename,
+               int x1,
+               int y1,
+               int x2,
+               int y2,
+               const std::string& marker_name,
+               int num_threads);
   bool initGuide();
   void prep();
   odb::dbDatabase* getDb() const { return db_; }
@@ -204,6 +205,7 @@ class TritonRoute
   void ta();
   void dr();
   void applyUpdates(const std::vector<std::vector<drUpdate>>& updates);
+  std::vector<odb::Rect> getDRCTiles() const;
   void getDRCMarkers(std::list<std::unique_ptr<frMarker>>& markers,
                      const odb::Rect& requiredDrcBox);
   void repairPDNVias();
@@ -6,12 +6,17 @@
 #include <algorithm>
 #include <boost/asio/post.hpp>
 #include <boost/bind/bind.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <cstdint>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -821,6 +826,20 @@ bool TritonRoute::writeGlobals(const std::string& name)
   return true;
 }
 
+static uint64_t hashDesignFile(const std::string& file_name)
+{
+  // Hash in fixed size chunks so the snapshot is never held in memory.
+  constexpr std::size_t chunk_size = 1 << 16;
+  std::ifstream file(file_name, std::ios::binary);
+  std::vector<char> chunk(chunk_size);
+  std::size_t hash = 0;
+  while (file.read(chunk.data(), chunk_size) || file.gcount() > 0) {
+    const std::string_view data(chunk.data(), file.gcount());
+    boost::hash_combine(hash, std::hash<std::string_view>{}(data));
+  }
+  return hash;
+}
+
 void TritonRoute::sendDesignDist()
 {
   if (distributed_) {
@@ -838,6 +857,7 @@ void TritonRoute::sendDesignDist()
     RoutingJobDescription* rjd
         = static_cast<RoutingJobDescription*>(desc.get());
     rjd->setDesignPath(design_path);
+    rjd->setDesignHash(hashDesignFile(design_path));
     rjd->setSharedDir(shared_volume_);
     rjd->setGlobalsPath(router_cfg_path);
     rjd->setDesignUpdate(false);
@@ -1071,83 +1091,116 @@ void TritonRoute::fixMaxSpacing(int num_threads)
   writer.updateDb(db_, router_cfg_.get());
 }
 
+// Tiles of 7x7 gcells.  Without a gcell grid (e.g. a routed DEF checked
+// without guides) the die is cut into squares of about the same size.
+std::vector<Rect> TritonRoute::getDRCTiles() const
+{
+  const int size = 7;
+  std::vector<Rect> tiles;
+  frBlock* block = design_->getTopBlock();
+  const auto& gCellPatterns = block->getGCellPatterns();
+  if (!gCellPatterns.empty()) {
+    auto& xgp = gCellPatterns.at(0);
+    auto& ygp = gCellPatterns.at(1);
+    for (int i = 0; i < (int) xgp.getCount(); i += size) {
+      for (int j = 0; j < (int) ygp.getCount(); j += size) {
+        Rect routeBox1 = block->getGCellBox(Point(i, j));
+        const int max_i = std::min((int) xgp.getCount() - 1, i + size - 1);
+        const int max_j = std::min((int) ygp.getCount() - 1, j + size - 1);
+        Rect routeBox2 = block->getGCellBox(Point(max_i, max_j));
+        tiles.emplace_back(routeBox1.xMin(),
+                           routeBox1.yMin(),
+                           routeBox2.xMax(),
+                           routeBox2.yMax());
+      }
+    }
+    return tiles;
+  }
+
+  // Size the tiles as 7 gcells of 15 tracks of the lowest routing layer.
+  frCoord pitch = 0;
+  for (const auto& layer : design_->getTech()->getLayers()) {
+    if (layer->getType() == dbTechLayerType::ROUTING && layer->getPitch()) {
+      pitch = layer->getPitch();
+      break;
+    }
+  }
+  const frCoord tile_size = std::max(pitch, 1) * 15 * size;
+  const Rect& die = block->getDieBox();
+  for (frCoord x = die.xMin(); x < die.xMax(); x += tile_size) {
+    for (frCoord y = die.yMin(); y < die.yMax(); y += tile_size) {
+      tiles.emplace_back(x,
+                         y,
+                         std::min(x + tile_size, die.xMax()),
+                         std::min(y + tile_size, die.yMax()));
+    }
+  }
+  return tiles;
+}
+
 void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
                                 const Rect& requiredDrcBox)
 {
-  std::vector<std::vector<std::unique_ptr<FlexGCWorker>>> workersBatches(1);
-  auto size = 7;
-  auto offset = 0;
-  auto gCellPatterns = design_->getTopBlock()->getGCellPatterns();
-  auto& xgp = gCellPatterns.at(0);
-  auto& ygp = gCellPatterns.at(1);
-  for (int i = offset; i < (int) xgp.getCount(); i += size) {
-    for (int j = offset; j < (int) ygp.getCount(); j += size) {
-      Rect routeBox1 = design_->getTopBlock()->getGCellBox(Point(i, j));
-      const int max_i = std::min((int) xgp.getCount() - 1, i + size - 1);
-      const int max_j = std::min((int) ygp.getCount(), j + size - 1);
-      Rect routeBox2 = design_->getTopBlock()->getGCellBox(Point(max_i, max_j));
-      Rect routeBox(routeBox1.xMin(),
-                    routeBox1.yMin(),
-                    routeBox2.xMax(),
-                    routeBox2.yMax());
-      Rect extBox;
-      Rect drcBox;
-      routeBox.bloat(router_cfg_->DRCSAFEDIST, drcBox);
-      routeBox.bloat(router_cfg_->MTSAFEDIST, extBox);
-      if (!drcBox.intersects(requiredDrcBox)) {
-        continue;
-      }
-      auto gcWorker = std::make_unique<FlexGCWorker>(
-          design_->getTech(), logger_, router_cfg_.get());
-      gcWorker->setDrcBox(drcBox);
-      gcWorker->setExtBox(extBox);
-      if (workersBatches.back().size() >= router_cfg_->BATCHSIZE) {
-        workersBatches.emplace_back();
-      }
-      workersBatches.back().push_back(std::move(gcWorker));
+  std::vector<Rect> routeBoxes;
+  for (const Rect& routeBox : getDRCTiles()) {
+    Rect drcBox;
+    routeBox.bloat(router_cfg_->DRCSAFEDIST, drcBox);
+    if (drcBox.intersects(requiredDrcBox)) {
+      routeBoxes.push_back(routeBox);
     }
   }
-  std::map<MarkerId, frMarker*> mapMarkers;
+  // Each tile is checked by its own short lived worker so only one worker
+  // per thread is alive at a time.
+  std::vector<std::vector<std::unique_ptr<frMarker>>> tileMarkers(
+      routeBoxes.size());
   omp_set_num_threads(router_cfg_->MAX_THREADS);
-  for (auto& workers : workersBatches) {
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < workers.size(); i++) {  // NOLINT
-      workers[i]->init(design_.get());
-      workers[i]->main();
+  for (int i = 0; i < routeBoxes.size(); i++) {  // NOLINT
+    Rect extBox;
+    Rect drcBox;
+    routeBoxes[i].bloat(router_cfg_->DRCSAFEDIST, drcBox);
+    routeBoxes[i].bloat(router_cfg_->MTSAFEDIST, extBox);
+    FlexGCWorker gcWorker(design_->getTech(), logger_, router_cfg_.get());
+    gcWorker.setDrcBox(drcBox);
+    gcWorker.setExtBox(extBox);
+    gcWorker.init(design_.get());
+    gcWorker.main();
+    for (auto& marker : gcWorker.getMarkers()) {
+      if (marker->getBBox().intersects(requiredDrcBox)) {
+        tileMarkers[i].push_back(std::make_unique<frMarker>(*marker));
+      }
     }
-    for (const auto& worker : workers) {
-      for (auto& marker : worker->getMarkers()) {
-        Rect bbox = marker->getBBox();
-        if (!bbox.intersects(requiredDrcBox)) {
-          continue;
-        }
-        auto layerNum = marker->getLayerNum();
-        auto con = marker->getConstraint();
-        if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
-            != mapMarkers.end()) {
-          continue;
-        }
-        markers.push_back(std::make_unique<frMarker>(*marker));
-        mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
-            = markers.back().get();
+  }
+  // Neighboring tiles find the markers near their seam through their halos,
+  // keep only the first of each.
+  std::set<MarkerId> seen;
+  for (auto& tile : tileMarkers) {
+    for (auto& marker : tile) {
+      if (seen.insert({marker->getBBox(),
+                       marker->getLayerNum(),
+                       marker->getConstraint(),
+                       marker->getSrcs()})
+              .second) {
+        markers.push_back(std::move(marker));
       }
     }
-    workers.clear();
   }
 }
 
-void TritonRoute::checkDRC(const char* filename,
-                           int x1,
-                           int y1,
-                           int x2,
-                           int y2,
-                           const std::string& marker_name,
-                           int num_threads)
+int TritonRoute::checkDRC(const char* filename,
+                          int x1,
+                          int y1,
+                          int x2,
+                          int y2,
+                          const std::string& marker_name,
+                          int num_threads)
 {
   router_cfg_->GC_IGNORE_PDN_LAYER_NUM = -1;
   router_cfg_->REPAIR_PDN_LAYER_NUM = -1;
   router_cfg_->MAX_THREADS = num_threads;
   initDesign();
+  // The gcell grid or the guides only shape the tiling; a routed design
+  // without either is checked on uniform tiles.
   auto gcellGrid = db_->getChip()->getBlock()->getGCellGrid();
   if (gcellGrid != nullptr && gcellGrid->getNumGridPatternsX() == 1
       && gcellGrid->getNumGridPatternsY() == 1) {
@@ -1156,7 +1209,8 @@ void TritonRoute::checkDRC(const char* filename,
     guide_processor.readGuides();
     guide_processor.buildGCellPatterns();
   } else if (!initGuide()) {
-    logger_->error(DRT, 1, "GCELLGRID is undefined");
+    logger_->info(
+        DRT, 623, "No GCELLGRID or route guides, checking on uniform tiles.");
   }
   Rect requiredDrcBox(x1, y1, x2, y2);
   if (requiredDrcBox.area() == 0) {
@@ -1165,6 +1219,7 @@ void TritonRoute::checkDRC(const char* filename,
   frList<std::unique_ptr<frMarker>> markers;
   getDRCMarkers(markers, requiredDrcBox);
   reportDRC(filename, markers, marker_name, requiredDrcBox);
+  return markers.size();
 }
 
 void TritonRoute::addUserSelectedVia(const std::string& viaName)
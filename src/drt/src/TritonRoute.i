@@ -212,10 +212,10 @@ void step_end()
   router->endFR();
 }
 
-void check_drc_cmd(const char* drc_file, int x1, int y1, int x2, int y2, const char* marker_name)
+int check_drc_cmd(const char* drc_file, int x1, int y1, int x2, int y2, const char* marker_name)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
-  router->checkDRC(drc_file, x1, y1, x2, y2, marker_name, num_threads);
+  return router->checkDRC(drc_file, x1, y1, x2, y2, marker_name, num_threads);
 }
 %} // inline
@@ -465,7 +465,7 @@ proc check_drc { args } {
   } else {
     utl::error DRT 613 "-output_file is required for check_drc command"
   }
-  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2 $marker_name
+  return [drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2 $marker_name]
 }
 
 proc fix_max_spacing { args } {
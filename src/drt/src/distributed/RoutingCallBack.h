@@ -111,15 +111,22 @@ class RoutingCallBack : public dst::JobCallBack
         router_->updateGlobals(desc->getGlobalsPath().c_str());
       }
     }
-    if ((desc->isDesignUpdate() && !desc->getUpdates().empty())
-        || !desc->getDesignPath().empty()) {
+    if (!desc->isDesignUpdate() && !desc->getDesignPath().empty()
+        && desc->getDesignHash() != 0
+        && desc->getDesignHash() == design_hash_) {
+      // The worker already holds this snapshot of the design.
+      logger_->report("Design Update skipped, design is up to date");
+    } else if ((desc->isDesignUpdate() && !desc->getUpdates().empty())
+               || !desc->getDesignPath().empty()) {
       frTime t;
       logger_->report("Design Update");
       if (desc->isDesignUpdate()) {
         router_->updateDesign(desc->getUpdates(),
                               router_->getRouterConfiguration()->MAX_THREADS);
+        design_hash_ = 0;
       } else {
         router_->resetDb(desc->getDesignPath().c_str());
+        design_hash_ = desc->getDesignHash();
       }
       t.print(logger_);
     }
@@ -142,6 +149,7 @@ class RoutingCallBack : public dst::JobCallBack
     PinAccessJobDescription* desc
         = static_cast<PinAccessJobDescription*>(msg.getJobDescription());
     logger_->report("Received PA Job");
+    design_hash_ = 0;
     dst::JobMessage result(dst::JobMessage::SUCCESS);
     switch (desc->getType()) {
       case PinAccessJobDescription::UPDATE_PA: {
@@ -196,6 +204,7 @@ class RoutingCallBack : public dst::JobCallBack
     if (msg.getJobType() != dst::JobMessage::GRDR_INIT) {
       return;
     }
+    design_hash_ = 0;
     router_->initGuide();
     router_->prep();
     router_->getDesign()->getRegionQuery()->initDRObj();
@@ -241,6 +250,9 @@ class RoutingCallBack : public dst::JobCallBack
   utl::Logger* logger_;
   std::string design_path_;
   std::string router_cfg_path_;
+  // Hash of the design file the worker's design was loaded from, reset once
+  // the design is modified by updates or pin access/routing setup jobs.
+  uint64_t design_hash_{0};
   bool init_;
   FlexDRViaData via_data_;
   FlexPA pa_;
@@ -3,6 +3,7 @@
 
 #pragma once
 #include <boost/serialization/base_object.hpp>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@ class RoutingJobDescription : public dst::JobDescription
   void setSendEvery(int val) { send_every_ = val; }
   void setViaData(const std::string& val) { via_data_ = val; }
   void setDesignUpdate(const bool& value) { design_update_ = value; }
+  void setDesignHash(uint64_t hash) { design_hash_ = hash; }
   const std::string& getGlobalsPath() const { return router_cfg_path_; }
   const std::string& getSharedDir() const { return shared_dir_; }
   const std::string& getDesignPath() const { return design_path_; }
@@ -41,6 +43,7 @@ class RoutingJobDescription : public dst::JobDescription
   }
   const std::vector<std::string>& getUpdates() { return updates_; }
   bool isDesignUpdate() const { return design_update_; }
+  uint64_t getDesignHash() const { return design_hash_; }
   int getSendEvery() const { return send_every_; }
   const std::string& getViaData() const { return via_data_; }
 
@@ -53,6 +56,8 @@ class RoutingJobDescription : public dst::JobDescription
   std::vector<std::string> updates_;
   std::string via_data_;
   bool design_update_{false};
+  // Hash of the design file, 0 if unknown.
+  uint64_t design_hash_{0};
   int send_every_{10};
 
   template <class Archive>
@@ -67,6 +72,7 @@ class RoutingJobDescription : public dst::JobDescription
     (ar) & updates_;
     (ar) & via_data_;
     (ar) & design_update_;
+    (ar) & design_hash_;
     (ar) & send_every_;
   }
   friend class boost::serialization::access;
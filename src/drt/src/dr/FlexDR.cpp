@@ -39,6 +39,7 @@
 #include "utl/Progress.h"
 #include "utl/ScopedTemporaryFile.h"
 #include "utl/exception.h"
+#include "utl/timer.h"
 
 BOOST_CLASS_EXPORT(drt::RoutingJobDescription)
 
@@ -103,6 +104,17 @@ FlexDR::FlexDR(TritonRoute* router,
       clipSizeInc_(0),
       iter_(0)
 {
+  auto registry = logger_->getRegistry();
+  iteration_gauge_ = &utl::BuildGauge()
+                          .Name("ord_drt_iteration")
+                          .Help("The current detailed routing iteration")
+                          .Register(*registry)
+                          .Add({});
+  violations_gauge_ = &utl::BuildGauge()
+                           .Name("ord_drt_violations")
+                           .Help("DRC violations after the last iteration")
+                           .Register(*registry)
+                           .Add({});
 }
 
 FlexDR::~FlexDR() = default;
@@ -1215,7 +1227,7 @@ void FlexDR::optimizationFlow(const SearchRepairArgs& args,
         const std::string batch_name = std::string("DR:batch<")
                                        + std::to_string(workersInBatch.size())
                                        + ">";
-        ProfileTask profile(batch_name.c_str());
+        ProfileTask profile(batch_name);
         if (dist_on_) {
           processWorkersBatchDistributed(workersInBatch, version, iter_prog);
         } else {
@@ -1238,7 +1250,7 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
       && getDesign()->getTopBlock()->getMarkers().empty()) {
     return;
   }
-  ProfileTask profile(fmt::format("DR:searchRepair{}", iter_).c_str());
+  ProfileTask profile(fmt::format("DR:searchRepair{}", iter_));
 
   if (dist_on_) {
     if ((iter_ % 10 == 0 && iter_ != 60) || iter_ == 3 || iter_ == 15) {
@@ -1277,6 +1289,8 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
     fixMaxSpacing();
   }
   numViols_.push_back(getDesign()->getTopBlock()->getNumMarkers());
+  iteration_gauge_->Set(iter_);
+  violations_gauge_->Set(numViols_.back());
   debugPrint(logger_,
              utl::DRT,
              "workers",
@@ -1901,7 +1915,8 @@ void FlexDR::sendWorkers(
   }
   std::string remote_ip = dist_ip_;
   uint16_t remote_port = dist_port_;
-  if (router_->getCloudSize() > 1) {
+  const bool balanced = router_->getCloudSize() > 1;
+  if (balanced) {
     dst::JobMessage msg(dst::JobMessage::BALANCER),
         result(dst::JobMessage::NONE);
     bool ok = dist_->sendJob(msg, dist_ip_.c_str(), dist_port_, result);
@@ -1927,8 +1942,18 @@ void FlexDR::sendWorkers(
     rjd->setSendEvery(20);
     msg.setJobDescription(std::move(desc));
     ProfileTask task("DIST: SENDJOB");
+    const utl::Timer job_timer;
     bool ok = dist_->sendJobMultiResult(
         msg, remote_ip.c_str(), remote_port, result);
+    if (balanced) {
+      // The job bypassed the balancer, so it has to be told the worker is
+      // free again and how long the job took.
+      dist_->reportJobFinished(dist_ip_.c_str(),
+                               dist_port_,
+                               remote_ip,
+                               remote_port,
+                               job_timer.elapsed());
+    }
     if (!ok) {
       logger_->error(utl::DRT, 500, "Sending worker {} failed");
     }
@@ -24,6 +24,7 @@
 #include "dst/JobMessage.h"
 #include "frDesign.h"
 #include "gc/FlexGC.h"
+#include "utl/prometheus/gauge.h"
 
 using Rectangle = boost::polygon::rectangle_data<int>;
 namespace dst {
@@ -142,6 +143,8 @@ class FlexDR
 
   FlexDRViaData via_data_;
   std::vector<int> numViols_;
+  utl::Gauge<double>* iteration_gauge_;
+  utl::Gauge<double>* violations_gauge_;
   std::unique_ptr<AbstractDRGraphics> graphics_{nullptr};
   std::string debugNetName_;
   int numWorkUnits_;
@@ -7,8 +7,19 @@
 #include <ittnotify.h>
 #endif
 
+#include <string>
+
+#include "utl/tracer.h"
+
 namespace drt {
 
+// Task names given as const char* must be string literals; names built at
+// runtime are passed as std::string and interned while tracing.
+inline const char* traceName(const std::string& name)
+{
+  return utl::Tracer::isEnabled() ? utl::Tracer::get().intern(name) : "";
+}
+
 #ifdef HAS_VTUNE
 // This class make a VTune task in its scope (RAII).  This is useful
 // in VTune to see where the runtime is going with more domain specific
@@ -16,11 +27,14 @@ namespace drt {
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) : done_(false)
+  ProfileTask(const char* name) : zone_(name, "drt"), done_(false)
   {
-    domain_ = __itt_domain_create("TritonRoute");
-    name_ = __itt_string_handle_create(name);
-    __itt_task_begin(domain_, __itt_null, __itt_null, name_);
+    begin(name);
+  }
+  ProfileTask(const std::string& name)
+      : zone_(traceName(name), "drt"), done_(false)
+  {
+    begin(name.c_str());
   }
 
   ~ProfileTask()
@@ -36,9 +50,18 @@ class ProfileTask
   {
     done_ = true;
     __itt_task_end(domain_);
+    zone_.done();
   }
 
  private:
+  void begin(const char* name)
+  {
+    domain_ = __itt_domain_create("TritonRoute");
+    name_ = __itt_string_handle_create(name);
+    __itt_task_begin(domain_, __itt_null, __itt_null, name_);
+  }
+
+  utl::TraceZone zone_;
   __itt_domain* domain_;
   __itt_string_handle* name_;
   bool done_;
@@ -50,8 +73,12 @@ class ProfileTask
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) {}
-  void done() {}
+  ProfileTask(const char* name) : zone_(name, "drt") {}
+  ProfileTask(const std::string& name) : zone_(traceName(name), "drt") {}
+  void done() { zone_.done(); }
+
+ private:
+  utl::TraceZone zone_;
 };
 #endif
 
@@ -3,6 +3,9 @@
 
 #include "frRegionQuery.h"
 
+#include <omp.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
 #include <boost/polygon/polygon.hpp>
 #include <iostream>
 #include <memory>
@@ -14,6 +17,7 @@
 #include "frRTree.h"
 #include "global.h"
 #include "utl/algorithms.h"
+#include "utl/exception.h"
 
 namespace drt {
 
@@ -22,6 +26,21 @@ class FlexDR;
 using utl::enumerate;
 namespace gtl = boost::polygon;
 
+namespace {
+
+// Output iterator appending only the objects of rtree query results, so the
+// queries returning plain object vectors need no temporary vector.
+template <typename T>
+auto objectInserter(std::vector<T>& result)
+{
+  return boost::make_function_output_iterator(
+      [&result](const rq_box_value_t<T>& value) {
+        result.push_back(value.second);
+      });
+}
+
+}  // namespace
+
 struct frRegionQuery::Impl
 {
   template <typename T>
@@ -71,8 +90,31 @@ struct frRegionQuery::Impl
   void addGRObj(grVia* via, ObjectsByLayer<grBlockObject>& allShapes);
   void addGRObj(grShape* shape);
   void addGRObj(grVia* via);
+
+  template <typename T>
+  void bulkLoad(ObjectsByLayer<T>& allObjs, RTreesByLayer<T*>& trees);
 };
 
+// Packs each layer's tree from its objects.  The layers are independent so
+// they are loaded in parallel; the objects are released as they are loaded.
+template <typename T>
+void frRegionQuery::Impl::bulkLoad(ObjectsByLayer<T>& allObjs,
+                                   RTreesByLayer<T*>& trees)
+{
+  utl::ThreadException exception;
+  omp_set_num_threads(router_cfg_->MAX_THREADS);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int) allObjs.size(); i++) {
+    try {
+      trees[i] = RTree<T*>(allObjs[i]);
+      Objects<T>().swap(allObjs[i]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+}
+
 frRegionQuery::frRegionQuery(frDesign* design,
                              Logger* logger,
                              RouterConfiguration* router_cfg)
@@ -591,23 +633,16 @@ void frRegionQuery::queryGuide(const Rect& box,
                                const frLayerNum layerNum,
                                std::vector<frGuide*>& result) const
 {
-  Objects<frGuide> temp;
-  queryGuide(box, layerNum, temp);
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->guides_.at(layerNum).query(bgi::intersects(box),
+                                    objectInserter(result));
 }
 
 void frRegionQuery::queryGuide(const Rect& box,
                                std::vector<frGuide*>& result) const
 {
-  Objects<frGuide> temp;
   for (auto& m : impl_->guides_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), objectInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::queryOrigGuide(const Rect& box,
@@ -621,11 +656,7 @@ void frRegionQuery::queryOrigGuide(const Rect& box,
 void frRegionQuery::queryGRPin(const Rect& box,
                                std::vector<frBlockObject*>& result) const
 {
-  Objects<frBlockObject> temp;
-  impl_->grPins_.query(bgi::intersects(box), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->grPins_.query(bgi::intersects(box), objectInserter(result));
 }
 
 void frRegionQuery::queryDRObj(const box_t& boostb,
@@ -648,58 +679,40 @@ void frRegionQuery::queryDRObj(const Rect& box,
                                const frLayerNum layerNum,
                                std::vector<frBlockObject*>& result) const
 {
-  Objects<frBlockObject> temp;
-  impl_->drObjs_.at(layerNum).query(bgi::intersects(box), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->drObjs_.at(layerNum).query(bgi::intersects(box),
+                                    objectInserter(result));
 }
 
 void frRegionQuery::queryDRObj(const Rect& box,
                                std::vector<frBlockObject*>& result) const
 {
-  Objects<frBlockObject> temp;
   for (auto& m : impl_->drObjs_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), objectInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::queryGRObj(const Rect& box,
                                std::vector<grBlockObject*>& result) const
 {
-  Objects<grBlockObject> temp;
   for (auto& m : impl_->grObjs_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), objectInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::queryMarker(const Rect& box,
                                 const frLayerNum layerNum,
                                 std::vector<frMarker*>& result) const
 {
-  Objects<frMarker> temp;
-  impl_->markers_.at(layerNum).query(bgi::intersects(box), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->markers_.at(layerNum).query(bgi::intersects(box),
+                                     objectInserter(result));
 }
 
 void frRegionQuery::queryMarker(const Rect& box,
                                 std::vector<frMarker*>& result) const
 {
-  Objects<frMarker> temp;
   for (auto& m : impl_->markers_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), objectInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::init()
@@ -783,10 +796,8 @@ void frRegionQuery::Impl::init()
     }
   }
 
+  bulkLoad(allShapes, shapes_);
   for (auto i = 0; i < numLayers; i++) {
-    shapes_.at(i) = boost::move(RTree<frBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
     if (router_cfg_->VERBOSE > 0) {
       logger_->info(DRT,
                     24,
@@ -828,10 +839,8 @@ void frRegionQuery::Impl::initOrigGuide(
       }
     }
   }
+  bulkLoad(allShapes, origGuides_);
   for (auto i = 0; i < numLayers; i++) {
-    origGuides_.at(i) = boost::move(RTree<frNet*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
     if (router_cfg_->VERBOSE > 0) {
       logger_->info(DRT,
                     28,
@@ -871,10 +880,8 @@ void frRegionQuery::Impl::initGuide()
       }
     }
   }
+  bulkLoad(allGuides, guides_);
   for (auto i = 0; i < numLayers; i++) {
-    guides_.at(i) = boost::move(RTree<frGuide*>(allGuides.at(i)));
-    allGuides.at(i).clear();
-    allGuides.at(i).shrink_to_fit();
     if (router_cfg_->VERBOSE > 0) {
       logger_->info(DRT,
                     35,
@@ -922,11 +929,7 @@ void frRegionQuery::Impl::initRPin()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    rpins_.at(i) = boost::move(RTree<frRPin*>(allRPins.at(i)));
-    allRPins.at(i).clear();
-    allRPins.at(i).shrink_to_fit();
-  }
+  bulkLoad(allRPins, rpins_);
 }
 
 void frRegionQuery::initDRObj()
@@ -955,11 +958,7 @@ void frRegionQuery::Impl::initDRObj()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    drObjs_.at(i) = boost::move(RTree<frBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
-  }
+  bulkLoad(allShapes, drObjs_);
 }
 
 void frRegionQuery::Impl::initGRObj()
@@ -980,11 +979,7 @@ void frRegionQuery::Impl::initGRObj()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    grObjs_.at(i) = boost::move(RTree<grBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
-  }
+  bulkLoad(allShapes, grObjs_);
 }
 
 void frRegionQuery::initGRObj()
@@ -38,6 +38,9 @@ FlexGCWorker::Impl::Impl(frTechObject* techIn,
       drWorker_(drWorkerIn),
       rq_(gcWorkerIn),
       printMarker_(false),
+      recordSegments_(false),
+      hasSegments_(false),
+      numSegmentNets_(0),
       targetNet_(nullptr),
       minLayerNum_(std::numeric_limits<frLayerNum>::min()),
       maxLayerNum_(std::numeric_limits<frLayerNum>::max()),
@@ -49,11 +52,24 @@ FlexGCWorker::Impl::Impl(frTechObject* techIn,
 {
 }
 
+std::unique_ptr<frMarker> FlexGCWorker::Impl::copyMarker(frMarker* in)
+{
+  auto marker = std::make_unique<frMarker>(*in);
+  marker->getVictims() = in->getVictims();
+  marker->getAggressors() = in->getAggressors();
+  return marker;
+}
+
 void FlexGCWorker::Impl::addMarker(std::unique_ptr<frMarker> in)
 {
   Rect bbox = in->getBBox();
   auto layerNum = in->getLayerNum();
   auto con = in->getConstraint();
+  if (recordSegments_) {
+    // keep every marker found, even duplicates, so replaying the segment
+    // later dedups exactly as a full check would
+    segmentMarkers_[currSegment_].push_back(copyMarker(in.get()));
+  }
   if (mapMarkers_.find({bbox, layerNum, con, in->getSrcs()})
       != mapMarkers_.end()) {
     return;
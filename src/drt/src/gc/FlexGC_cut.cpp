@@ -664,6 +664,9 @@ void FlexGCWorker::Impl::checkMetalWidthViaTable()
         if (fr_net && (fr_net->isSpecial() || fr_net->getType().isSupply())) {
           continue;
         }
+        if (!checkSegment(CheckType::MetalWidthViaTable, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkMetalWidthViaTable_main(maxrect.get());
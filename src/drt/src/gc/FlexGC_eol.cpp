@@ -1342,6 +1342,9 @@ void FlexGCWorker::Impl::checkMetalEndOfLine()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!checkSegment(CheckType::EndOfLine, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           checkMetalEndOfLine_main(pin.get());
         }
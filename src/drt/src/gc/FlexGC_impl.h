@@ -8,6 +8,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -138,6 +139,32 @@ class FlexGCWorker::Impl
   // temps
   std::vector<drNet*> modifiedDRNets_;
 
+  // incremental re-check: markers of the last full check in a DR worker,
+  // kept per (check, layer, net) segment in the order they were found.  The
+  // next full check only re-runs segments of nets near modified shapes and
+  // replays the others.
+  enum class CheckType
+  {
+    CornerSpacing,
+    MetalSpacing,
+    MetalShape,
+    EndOfLine,
+    CutSpacing,
+    SpacingTableInfluence,
+    MinimumCut,
+    MetalWidthViaTable
+  };
+  using SegmentKey = std::tuple<CheckType, frLayerNum, int>;
+  std::map<SegmentKey, std::vector<std::unique_ptr<frMarker>>>
+      segmentMarkers_;
+  SegmentKey currSegment_;
+  bool recordSegments_;
+  bool hasSegments_;
+  int numSegmentNets_;
+  std::vector<bool> recheckNets_;
+  std::set<int> dirtyNets_;
+  std::vector<Rect> dirtyBoxes_;
+
   // parameters
   gcNet* targetNet_;
   frLayerNum minLayerNum_;
@@ -154,6 +181,11 @@ class FlexGCWorker::Impl
   FlexGCWorkerRegionQuery& getWorkerRegionQuery() { return rq_; }
 
   void modifyMarkers();
+  // incremental re-check
+  static std::unique_ptr<frMarker> copyMarker(frMarker* in);
+  void addDirtyBoxes(gcNet* net);
+  void initRecheck();
+  bool checkSegment(CheckType type, frLayerNum layerNum, gcNet* net);
   // init
   gcNet* getNet(frBlockObject* obj);
   gcNet* getNet(frNet* net);
@@ -228,6 +228,9 @@ void FlexGCWorker::Impl::checkMetalSpacingTableInfluence()
         continue;
       }
       for (auto& uNet : getNets()) {
+        if (!checkSegment(CheckType::SpacingTableInfluence, i, uNet.get())) {
+          continue;
+        }
         for (auto& pin : uNet->getPins(i)) {
           checkPinMetSpcTblInf(pin.get());
         }
@@ -987,6 +987,7 @@ void FlexGCWorker::Impl::updateGCWorker()
   // start init from dr objs
   for (auto fnet : fnets) {
     auto net = owner2nets_[fnet];
+    addDirtyBoxes(net);
     getWorkerRegionQuery().removeFromRegionQuery(
         net);      // delete all region queries
     net->clear();  // delete all pins and routeXXX
@@ -1023,6 +1024,36 @@ void FlexGCWorker::Impl::updateGCWorker()
     // init gc net
     initNet(net);
     getWorkerRegionQuery().addToRegionQuery(net);
+    addDirtyBoxes(net);
+  }
+}
+
+// Records the extent of net's shapes, bloated by the largest distance two
+// shapes can interact over, for the next full check to re-run.
+void FlexGCWorker::Impl::addDirtyBoxes(gcNet* net)
+{
+  if (!hasSegments_) {
+    return;
+  }
+  dirtyNets_.insert(net->getId());
+  const frCoord bloat_dist = router_cfg_->MTSAFEDIST;
+  gtl::rectangle_data<frCoord> extent;
+  for (auto& layer_pins : net->getPins()) {
+    for (auto& pin : layer_pins) {
+      if (gtl::extents(extent, *pin->getPolygon())) {
+        Rect box(gtl::xl(extent),
+                 gtl::yl(extent),
+                 gtl::xh(extent),
+                 gtl::yh(extent));
+        box.bloat(bloat_dist, box);
+        dirtyBoxes_.push_back(box);
+      }
+    }
+  }
+  for (auto& rect : net->getSpecialSpcRects()) {
+    Rect box(gtl::xl(*rect), gtl::yl(*rect), gtl::xh(*rect), gtl::yh(*rect));
+    box.bloat(bloat_dist, box);
+    dirtyBoxes_.push_back(box);
   }
 }
 
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "frProfileTask.h"
+#include "frRTree.h"
 #include "gc/FlexGC_impl.h"
 
 namespace drt {
@@ -908,6 +909,9 @@ void FlexGCWorker::Impl::checkMetalSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!checkSegment(CheckType::MetalSpacing, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           if (currLayer->hasLef58SpacingWrongDirConstraints()) {
             checkMetalSpacing_wrongDir(pin.get(), currLayer);
@@ -1397,6 +1401,9 @@ void FlexGCWorker::Impl::checkMetalCornerSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!checkSegment(CheckType::CornerSpacing, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& corners : pin->getPolygonCorners()) {
             for (auto& corner : corners) {
@@ -2415,6 +2422,9 @@ void FlexGCWorker::Impl::checkMetalShape(bool allow_patching)
         continue;
       }
       for (auto& net : getNets()) {
+        if (!checkSegment(CheckType::MetalShape, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           checkMetalShape_main(pin.get(), allow_patching);
         }
@@ -3644,6 +3654,9 @@ void FlexGCWorker::Impl::checkCutSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!checkSegment(CheckType::CutSpacing, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkCutSpacing_main(maxrect.get());
@@ -4032,6 +4045,9 @@ void FlexGCWorker::Impl::checkMinimumCut()
         continue;
       }
       for (auto& net : getNets()) {
+        if (!checkSegment(CheckType::MinimumCut, i, net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkMinimumCut_main(maxrect.get());
@@ -4173,6 +4189,91 @@ void FlexGCWorker::Impl::modifyMarkers()
   }
 }
 
+// A full check in a DR worker only re-runs the nets that were modified since
+// the previous full check or have shapes within MTSAFEDIST of a modified
+// shape; the markers of all other nets are replayed from that check.
+void FlexGCWorker::Impl::initRecheck()
+{
+  recordSegments_ = false;
+  if (!getDRWorker() || targetNet_) {
+    return;
+  }
+  const int num_nets = nets_.size();
+  recheckNets_.assign(num_nets, !hasSegments_);
+  if (hasSegments_) {
+    for (int id = numSegmentNets_; id < num_nets; id++) {
+      recheckNets_[id] = true;
+    }
+    for (int id : dirtyNets_) {
+      recheckNets_[id] = true;
+    }
+    if (!dirtyBoxes_.empty()) {
+      const bgi::rtree<Rect, bgi::quadratic<16>> dirty(dirtyBoxes_);
+      auto isDirty = [&dirty](const Rect& box) {
+        return dirty.qbegin(bgi::intersects(box)) != dirty.qend();
+      };
+      auto isNearDirty = [&isDirty](gcNet* net) {
+        gtl::rectangle_data<frCoord> extent;
+        for (auto& layer_pins : net->getPins()) {
+          for (auto& pin : layer_pins) {
+            if (gtl::extents(extent, *pin->getPolygon())
+                && isDirty(Rect(gtl::xl(extent),
+                                gtl::yl(extent),
+                                gtl::xh(extent),
+                                gtl::yh(extent)))) {
+              return true;
+            }
+          }
+        }
+        for (auto& rect : net->getSpecialSpcRects()) {
+          if (isDirty(Rect(gtl::xl(*rect),
+                           gtl::yl(*rect),
+                           gtl::xh(*rect),
+                           gtl::yh(*rect)))) {
+            return true;
+          }
+        }
+        return false;
+      };
+      for (auto& net : nets_) {
+        if (!recheckNets_[net->getId()] && isNearDirty(net.get())) {
+          recheckNets_[net->getId()] = true;
+        }
+      }
+    }
+  }
+  recordSegments_ = true;
+  hasSegments_ = true;
+  numSegmentNets_ = num_nets;
+  dirtyNets_.clear();
+  dirtyBoxes_.clear();
+}
+
+// Returns true if the (type, layerNum, net) segment must be checked;
+// otherwise the markers it had in the previous full check are added.
+bool FlexGCWorker::Impl::checkSegment(CheckType type,
+                                      frLayerNum layerNum,
+                                      gcNet* net)
+{
+  if (!recordSegments_) {
+    return true;
+  }
+  currSegment_ = {type, layerNum, net->getId()};
+  if (recheckNets_[net->getId()]) {
+    segmentMarkers_.erase(currSegment_);
+    return true;
+  }
+  auto it = segmentMarkers_.find(currSegment_);
+  if (it != segmentMarkers_.end()) {
+    recordSegments_ = false;
+    for (auto& marker : it->second) {
+      addMarker(copyMarker(marker.get()));
+    }
+    recordSegments_ = true;
+  }
+  return false;
+}
+
 int FlexGCWorker::Impl::main()
 {
   // incremental updates
@@ -4193,6 +4294,7 @@ int FlexGCWorker::Impl::main()
   }
   // clear existing markers
   clearMarkers();
+  initRecheck();
   // check LEF58CornerSpacing and LEF58WidthTable ORTH
   checkMetalCornerSpacing();
   // check Short, NSMet, MetSpc based on max rectangles
@@ -4209,6 +4311,7 @@ int FlexGCWorker::Impl::main()
   checkMinimumCut();
   // check LEF58_METALWIDTHVIATABLE
   checkMetalWidthViaTable();
+  recordSegments_ = false;
   // modify markers for pwires
   modifyMarkers();
   return 0;
@@ -102,7 +102,7 @@ int FlexTA::initTA_helper(int iter,
   auto& ygp = gCellPatterns.at(1);
   int sol = 0;
   numPanels = 0;
-  std::vector<std::vector<std::unique_ptr<FlexTAWorker>>> workers;
+  std::vector<std::unique_ptr<FlexTAWorker>> workers;
   if (isH) {
     for (int i = offset; i < (int) ygp.getCount(); i += size) {
       auto uworker = std::make_unique<FlexTAWorker>(
@@ -120,11 +120,7 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::HORIZONTAL);
       worker.setTAIter(iter);
-      if (workers.empty()
-          || (int) workers.back().size() >= router_cfg_->BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().emplace_back(std::move(uworker));
+      workers.push_back(std::move(uworker));
     }
   } else {
     for (int i = offset; i < (int) xgp.getCount(); i += size) {
@@ -143,38 +139,52 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::VERTICAL);
       worker.setTAIter(iter);
-      if (workers.empty()
-          || (int) workers.back().size() >= router_cfg_->BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().push_back(std::move(uworker));
+      workers.push_back(std::move(uworker));
     }
   }
 
-  omp_set_num_threads(std::min(8, router_cfg_->MAX_THREADS));
-  // parallel execution
-  // multi thread
-  for (auto& workerBatch : workers) {
+  // A panel reads the wires its neighbours wrote back, so the panels are
+  // grouped into blocks of BATCHSIZETA adjacent panels that are assigned
+  // together and the blocks are colored so that no two blocks of a color
+  // touch.  Blocks of one color don't interact, so they run concurrently on
+  // every thread and the result doesn't depend on the thread count.  They
+  // are run in chunks of whole blocks, about two panels per thread, so only
+  // a chunk of initialized workers is alive at a time.
+  const int block_size = std::max(1, router_cfg_->BATCHSIZETA);
+  const int chunk_size
+      = block_size * std::max(1, 2 * router_cfg_->MAX_THREADS / block_size);
+  omp_set_num_threads(router_cfg_->MAX_THREADS);
+  for (int color = 0; color < 2; color++) {
     ProfileTask profile("TA:batch");
-    utl::ThreadException exception;
+    std::vector<std::unique_ptr<FlexTAWorker>> colorWorkers;
+    for (int i = 0; i < (int) workers.size(); i++) {
+      if ((i / block_size) % 2 == color) {
+        colorWorkers.push_back(std::move(workers[i]));
+      }
+    }
+    for (int begin = 0; begin < (int) colorWorkers.size();
+         begin += chunk_size) {
+      const int end = std::min((int) colorWorkers.size(), begin + chunk_size);
+      utl::ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < (int) workerBatch.size(); i++) {
-      try {
-        workerBatch[i]->main_mt();
+      for (int i = begin; i < end; i++) {
+        try {
+          colorWorkers[i]->main_mt();
 #pragma omp critical
-        {
-          sol += workerBatch[i]->getNumAssigned();
-          numPanels++;
+          {
+            sol += colorWorkers[i]->getNumAssigned();
+            numPanels++;
+          }
+        } catch (...) {
+          exception.capture();
         }
-      } catch (...) {
-        exception.capture();
+      }
+      exception.rethrow();
+      for (int i = begin; i < end; i++) {
+        colorWorkers[i]->end();
+        colorWorkers[i].reset();
       }
     }
-    exception.rethrow();
-    for (auto& worker : workerBatch) {
-      worker->end();
-    }
-    workerBatch.clear();
   }
   return sol;
 }
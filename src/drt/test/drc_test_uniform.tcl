@@ -0,0 +1,22 @@
+# check_drc on a routed design with neither a GCELLGRID nor route guides
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+
+# Strip the GCELLGRID statements so check_drc falls back to uniform tiles.
+set def_in [open drc_test.def]
+set def_file [make_result_file drc_test_uniform.def]
+set def_out [open $def_file w]
+while { [gets $def_in line] >= 0 } {
+  if { ![string match "GCELLGRID*" $line] } {
+    puts $def_out $line
+  }
+}
+close $def_in
+close $def_out
+read_def $def_file
+
+set drc_file [make_result_file drc_test_uniform.drc]
+set count [drt::check_drc -output_file $drc_file]
+puts "violation count = $count"
+diff_files $drc_file drc_test.drcok
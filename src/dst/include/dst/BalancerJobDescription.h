@@ -19,10 +19,14 @@ class BalancerJobDescription : public JobDescription
   void setWorkerPort(unsigned short port) { worker_port_ = port; }
   std::string getWorkerIP() const { return worker_ip_; }
   unsigned short getWorkerPort() const { return worker_port_; }
+  // Seconds the worker spent on a job, reported with BALANCER_FINISH.
+  void setJobTime(double time) { job_time_ = time; }
+  double getJobTime() const { return job_time_; }
 
  private:
   std::string worker_ip_;
   unsigned short worker_port_;
+  double job_time_{0};
 
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version)
@@ -30,6 +34,7 @@ class BalancerJobDescription : public JobDescription
     (ar) & boost::serialization::base_object<dst::JobDescription>(*this);
     (ar) & worker_ip_;
     (ar) & worker_port_;
+    (ar) & job_time_;
   }
   friend class boost::serialization::access;
 };
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <boost/asio.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,6 +26,16 @@ class Worker;
 class Distributed
 {
  public:
+  // Totals over every message sent or received through this object.
+  struct MessageStats
+  {
+    uint64_t sent_messages;
+    uint64_t sent_bytes;
+    uint64_t received_messages;
+    uint64_t received_bytes;
+    double job_seconds;  // send to last result byte, summed over jobs
+  };
+
   Distributed(utl::Logger* logger = nullptr);
   ~Distributed();
   void init(utl::Logger* logger);
@@ -40,9 +52,18 @@ class Distributed
                           const char* ip,
                           unsigned short port,
                           JobMessage& result);
+  // Tells the balancer that a job it assigned through a BALANCER request
+  // finished on the worker after job_time seconds, so the worker's load and
+  // measured throughput stay current.
+  bool reportJobFinished(const char* balancer_ip,
+                         unsigned short balancer_port,
+                         const std::string& worker_ip,
+                         unsigned short worker_port,
+                         double job_time);
   bool sendResult(JobMessage& msg, socket& sock);
   void addCallBack(JobCallBack* cb);
   const std::vector<JobCallBack*>& getCallBacks() const { return callbacks_; }
+  MessageStats getMessageStats() const;
 
  private:
   struct EndPoint
@@ -58,5 +79,17 @@ class Distributed
   std::vector<EndPoint> end_points_;
   std::vector<JobCallBack*> callbacks_;
   std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<uint64_t> sent_messages_{0};
+  std::atomic<uint64_t> sent_bytes_{0};
+  std::atomic<uint64_t> received_messages_{0};
+  std::atomic<uint64_t> received_bytes_{0};
+  std::atomic<uint64_t> job_usecs_{0};
+
+  static bool readFrame(socket& sock, std::string& frame, std::string& error);
+  void recordJob(const JobMessage& msg,
+                 std::size_t sent_bytes,
+                 std::size_t received_messages,
+                 std::size_t received_bytes,
+                 double seconds);
 };
 }  // namespace dst
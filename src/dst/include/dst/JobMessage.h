@@ -2,6 +2,8 @@
 // Copyright (c) 2021-2025, The OpenROAD Authors
 
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -37,6 +39,7 @@ class JobMessage
     ROUTING,
     UPDATE_DESIGN,
     BALANCER,
+    BALANCER_FINISH,
     PIN_ACCESS,
     GRDR_INIT,
     SUCCESS,
@@ -77,8 +80,15 @@ class JobMessage
   std::unique_ptr<JobDescription> desc_;
   std::vector<std::unique_ptr<JobDescription>> descs_;
 
-  static constexpr const char* EOP
-      = "\r\nENDOFPACKET\r\n";  // ENDOFPACKET SEQUENCE
+  // Messages travel as frames: a fixed size little endian header (magic,
+  // flags, raw size and payload size) followed by the text archive of the
+  // message, which is lz4 compressed when FRAME_LZ4 is set.
+  static constexpr uint32_t FRAME_MAGIC = 0x46545344;  // "DSTF"
+  static constexpr std::size_t FRAME_HEADER_SIZE = 24;
+  static constexpr uint32_t FRAME_LZ4 = 1;
+  // Frames whose payload or decoded archive is larger than this are
+  // rejected before any buffer is sized from the header.
+  static constexpr uint64_t FRAME_MAX_PAYLOAD_SIZE = uint64_t(1) << 30;
 
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);
@@ -90,9 +100,16 @@ class JobMessage
     READ,
     WRITE
   };
+  // WRITE replaces str with the frame of msg; READ decodes the frame in str.
   static bool serializeMsg(SerializeType type,
                            JobMessage& msg,
                            std::string& str);
+  static bool deserializeFrame(const char* frame,
+                               std::size_t size,
+                               JobMessage& msg);
+  // Reads the payload size from a frame header; false if it isn't one or
+  // the payload exceeds FRAME_MAX_PAYLOAD_SIZE.
+  static bool getPayloadSize(const char* header, std::size_t& payload_size);
   friend class dst::Distributed;
   friend class dst::WorkerConnection;
   friend class dst::BalancerConnection;
@@ -24,6 +24,7 @@
 #include "dst/BroadcastJobDescription.h"
 #include "dst/Distributed.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 using namespace dst;
 
@@ -44,10 +45,42 @@ tcp::socket& BalancerConnection::socket()
 
 void BalancerConnection::start()
 {
-  async_read_until(
+  in_packet_.resize(JobMessage::FRAME_HEADER_SIZE);
+  asio::async_read(
       sock_,
-      in_packet_,
-      JobMessage::EOP,
+      asio::buffer(in_packet_),
+      [me = shared_from_this()](boost::system::error_code const& ec,
+                                std::size_t bytes_xfer) {
+        me->handle_header(ec, bytes_xfer);
+      });
+}
+
+void BalancerConnection::handle_header(boost::system::error_code const& err,
+                                       size_t bytes_transferred)
+{
+  std::size_t payload_size = 0;
+  if (!err && !JobMessage::getPayloadSize(in_packet_.data(), payload_size)) {
+    boost::system::error_code error;
+    logger_->warn(utl::DST,
+                  42,
+                  "Received malformed msg of {} bytes from port {}",
+                  in_packet_.size(),
+                  sock_.remote_endpoint().port());
+    asio::write(sock_, asio::buffer("0"), error);
+    sock_.close();
+    return;
+  }
+  if (err) {
+    boost::thread t(
+        &BalancerConnection::handle_read, shared_from_this(), err, 0);
+    t.detach();
+    return;
+  }
+  in_packet_.resize(JobMessage::FRAME_HEADER_SIZE + payload_size);
+  asio::async_read(
+      sock_,
+      asio::buffer(in_packet_.data() + JobMessage::FRAME_HEADER_SIZE,
+                   payload_size),
       [me = shared_from_this()](boost::system::error_code const& ec,
                                 std::size_t bytes_xfer) {
         boost::thread t(&BalancerConnection::handle_read, me, ec, bytes_xfer);
@@ -60,14 +93,13 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
 {
   if (!err) {
     boost::system::error_code error;
-    std::string data{buffers_begin(in_packet_.data()),
-                     buffers_begin(in_packet_.data()) + bytes_transferred};
     JobMessage msg(JobMessage::NONE);
-    if (!JobMessage::serializeMsg(JobMessage::READ, msg, data)) {
+    if (!JobMessage::deserializeFrame(
+            in_packet_.data(), in_packet_.size(), msg)) {
       logger_->warn(utl::DST,
                     42,
-                    "Received malformed msg {} from port {}",
-                    data,
+                    "Received malformed msg of {} bytes from port {}",
+                    in_packet_.size(),
                     sock_.remote_endpoint().port());
       asio::write(sock_, asio::buffer("0"), error);
       sock_.close();
@@ -75,6 +107,28 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
     }
     switch (msg.getMessageType()) {
       case JobMessage::UNICAST: {
+        if (msg.getJobType() == JobMessage::BALANCER_FINISH) {
+          // A job handed out through a BALANCER request was sent to the
+          // worker directly; the client reports its completion here.
+          auto desc = dynamic_cast<BalancerJobDescription*>(
+              msg.getJobDescription());
+          boost::system::error_code ec;
+          ip::address workerAddress;
+          if (desc != nullptr) {
+            workerAddress = ip::make_address(desc->getWorkerIP(), ec);
+          }
+          if (desc == nullptr || ec) {
+            JobMessage reply(JobMessage::ERROR);
+            owner_->dist_->sendResult(reply, sock_);
+          } else {
+            owner_->finishJob(
+                workerAddress, desc->getWorkerPort(), desc->getJobTime());
+            JobMessage reply(JobMessage::SUCCESS);
+            owner_->dist_->sendResult(reply, sock_);
+          }
+          sock_.close();
+          break;
+        }
         ip::address workerAddress;
         unsigned short port;
         owner_->getNextWorker(workerAddress, port);
@@ -98,11 +152,13 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
             asio::streambuf receive_buffer;
             bool failure = true;
             while (failure) {
+              const utl::Timer job_timer;
               try {
                 socket.connect(tcp::endpoint(workerAddress, port));
-                asio::write(socket, in_packet_);
+                asio::write(socket, asio::buffer(in_packet_));
                 asio::read(socket, receive_buffer, asio::transfer_all());
                 failure = false;
+                owner_->finishJob(workerAddress, port, job_timer.elapsed());
               } catch (std::exception const& ex) {
                 if (socket.is_open()) {
                   socket.close();
@@ -112,6 +168,7 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
                   // Since asio::transfer_all() used with a stream buffer it
                   // always reach an eof file exception!
                   failure = false;
+                  owner_->finishJob(workerAddress, port, job_timer.elapsed());
                   break;
                 }
                 logger_->warn(utl::DST,
@@ -149,17 +206,15 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
       }
       case JobMessage::BROADCAST: {
         std::lock_guard<std::mutex> lock(owner_->workers_mutex_);
-        owner_->broadcastData.push_back(data);
+        owner_->broadcastData.push_back(in_packet_);
+        const std::string& data = owner_->broadcastData.back();
         asio::thread_pool pool(owner_->workers_.size());
-        auto workers_copy = owner_->workers_;
         std::mutex broadcast_failure_mutex;
         std::vector<std::pair<ip::address, unsigned short>> failed_workers;
-        while (!workers_copy.empty()) {
-          auto worker = workers_copy.top();
-          workers_copy.pop();
+        for (const auto& worker : owner_->workers_) {
           asio::post(
               pool,
-              [worker, data, &failed_workers, &broadcast_failure_mutex]() {
+              [worker, &data, &failed_workers, &broadcast_failure_mutex]() {
                 try {
                   asio::io_context service;
                   tcp::socket socket(service);
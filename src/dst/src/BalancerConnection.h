@@ -6,6 +6,7 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/make_shared.hpp>
 #include <cstddef>
+#include <string>
 
 namespace utl {
 class Logger;
@@ -33,13 +34,15 @@ class BalancerConnection
   }
   tcp::socket& socket();
   void start();
+  void handle_header(boost::system::error_code const& err,
+                     size_t bytes_transferred);
   void handle_read(boost::system::error_code const& err,
                    size_t bytes_transferred);
   LoadBalancer* getOwner() const { return owner_; }
 
  private:
   tcp::socket sock_;
-  asio::streambuf in_packet_;
+  std::string in_packet_;
   utl::Logger* logger_;
   LoadBalancer* owner_;
   const int MAX_FAILED_WORKERS_TRIALS = 3;
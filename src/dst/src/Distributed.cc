@@ -7,15 +7,19 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/system/system_error.hpp>
 #include <boost/thread/thread.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include "LoadBalancer.h"
 #include "Worker.h"
+#include "dst/BalancerJobDescription.h"
 #include "dst/JobCallBack.h"
 #include "dst/JobMessage.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 namespace dst {
 const int MAX_TRIES = 5;
 }
@@ -97,26 +101,72 @@ bool sendMsg(dst::socket& sock, const std::string& msg, std::string& errorMsg)
   return false;
 }
 
-bool readMsg(dst::socket& sock, std::string& dataStr)
+// Reads exactly one frame; returns false with an empty error once the peer
+// has closed the connection between frames.
+bool Distributed::readFrame(dst::socket& sock,
+                            std::string& frame,
+                            std::string& error)
 {
-  boost::system::error_code error;
-  asio::streambuf receive_buffer;
-  sock.wait(asio::ip::tcp::socket::wait_read);
-  asio::read(sock, receive_buffer, asio::transfer_all(), error);
-  if (error && error != asio::error::eof) {
-    dataStr = error.message();
+  boost::system::error_code ec;
+  frame.resize(JobMessage::FRAME_HEADER_SIZE);
+  asio::read(sock, asio::buffer(frame), ec);
+  if (ec) {
+    error = ec == asio::error::eof ? "" : ec.message();
     return false;
   }
+  std::size_t payload_size;
+  if (!JobMessage::getPayloadSize(frame.data(), payload_size)) {
+    error = "Malformed message frame";
+    return false;
+  }
+  frame.resize(JobMessage::FRAME_HEADER_SIZE + payload_size);
+  asio::read(sock,
+             asio::buffer(frame.data() + JobMessage::FRAME_HEADER_SIZE,
+                          payload_size),
+             ec);
+  if (ec) {
+    error = ec.message();
+    return false;
+  }
+  return true;
+}
 
-  auto bufs = receive_buffer.data();
-  auto offset = asio::buffers_begin(bufs) + receive_buffer.size();
-  std::string result;
-  if (offset <= asio::buffers_end(bufs)) {
-    result = std::string(asio::buffers_begin(bufs), offset);
+void Distributed::recordJob(const JobMessage& msg,
+                            std::size_t sent_bytes,
+                            std::size_t received_messages,
+                            std::size_t received_bytes,
+                            double seconds)
+{
+  sent_messages_++;
+  sent_bytes_ += sent_bytes;
+  received_messages_ += received_messages;
+  received_bytes_ += received_bytes;
+  job_usecs_ += static_cast<uint64_t>(seconds * 1e6);
+  if (logger_ == nullptr) {
+    return;
   }
+  debugPrint(logger_,
+             utl::DST,
+             "messages",
+             1,
+             "Job type {} sent {} bytes, received {} messages ({} bytes) in "
+             "{:.3f}s.",
+             (int) msg.getJobType(),
+             sent_bytes,
+             received_messages,
+             received_bytes,
+             seconds);
+}
 
-  dataStr = result;
-  return !dataStr.empty();
+Distributed::MessageStats Distributed::getMessageStats() const
+{
+  MessageStats stats;
+  stats.sent_messages = sent_messages_;
+  stats.sent_bytes = sent_bytes_;
+  stats.received_messages = received_messages_;
+  stats.received_bytes = received_bytes_;
+  stats.job_seconds = job_usecs_ / 1e6;
+  return stats;
 }
 
 bool Distributed::sendJob(JobMessage& msg,
@@ -131,6 +181,7 @@ bool Distributed::sendJob(JobMessage& msg,
     return false;
   }
   std::string resultStr;
+  std::string error;
   while (tries++ < MAX_TRIES) {
     asio::io_context service;
     dst::socket sock(service);
@@ -144,42 +195,33 @@ bool Distributed::sendJob(JobMessage& msg,
                     ex.what());
       continue;
     }
-    bool ok = sendMsg(sock, msgStr, resultStr);
+    const utl::Timer job_timer;
+    bool ok = sendMsg(sock, msgStr, error);
     if (!ok) {
       continue;
     }
-    ok = readMsg(sock, resultStr);
+    sock.wait(asio::ip::tcp::socket::wait_read);
+    ok = readFrame(sock, resultStr, error);
     if (!ok) {
       continue;
     }
     if (!JobMessage::serializeMsg(JobMessage::READ, result, resultStr)) {
+      error = "Malformed result message";
       continue;
     }
+    recordJob(msg, msgStr.size(), 1, resultStr.size(), job_timer.elapsed());
     if (sock.is_open()) {
       sock.close();
     }
     return true;
   }
-  if (resultStr.empty()) {
-    resultStr = "MAX_TRIES reached";
+  if (error.empty()) {
+    error = "MAX_TRIES reached";
   }
-  logger_->warn(
-      utl::DST, 114, "Sending job failed with message \"{}\"", resultStr);
+  logger_->warn(utl::DST, 114, "Sending job failed with message \"{}\"", error);
   return false;
 }
 
-inline bool getNextMsg(std::string& haystack,
-                       const std::string& needle,
-                       std::string& result)
-{
-  std::size_t found = haystack.find(needle);
-  if (found != std::string::npos) {
-    result = haystack.substr(0, found + needle.size());
-    haystack.erase(0, found + needle.size());
-    return true;
-  }
-  return false;
-}
 bool Distributed::sendJobMultiResult(JobMessage& msg,
                                      const char* ip,
                                      unsigned short port,
@@ -191,7 +233,7 @@ bool Distributed::sendJobMultiResult(JobMessage& msg,
     logger_->warn(utl::DST, 12, "Serializing JobMessage failed");
     return false;
   }
-  std::string resultStr;
+  std::string error;
   while (tries++ < MAX_TRIES) {
     asio::io_context service;
     dst::socket sock(service);
@@ -206,37 +248,70 @@ bool Distributed::sendJobMultiResult(JobMessage& msg,
     }
     boost::asio::ip::tcp::no_delay option(true);
     sock.set_option(option);
-    bool ok = sendMsg(sock, msgStr, resultStr);
+    const utl::Timer job_timer;
+    bool ok = sendMsg(sock, msgStr, error);
     if (!ok) {
       continue;
     }
-    ok = readMsg(sock, resultStr);
-    if (!ok) {
-      continue;
-    }
-    std::string split;
-    while (getNextMsg(resultStr, JobMessage::EOP, split)) {
+    sock.wait(asio::ip::tcp::socket::wait_read);
+    // The results arrive back to back on the socket; read them frame by frame
+    // until the worker closes the connection.
+    std::string frame;
+    std::size_t received_messages = 0;
+    std::size_t received_bytes = 0;
+    while (readFrame(sock, frame, error)) {
+      received_messages++;
+      received_bytes += frame.size();
       JobMessage tmp;
-      if (!JobMessage::serializeMsg(JobMessage::READ, tmp, split)) {
-        logger_->error(utl::DST, 9999, "Problem in deserialize {}", split);
+      if (!JobMessage::serializeMsg(JobMessage::READ, tmp, frame)) {
+        logger_->error(
+            utl::DST, 9999, "Problem in deserialize of {} bytes", frame.size());
       } else {
         result.addJobDescription(std::move(tmp.getJobDescriptionRef()));
       }
     }
+    if (received_messages == 0) {
+      continue;
+    }
+    if (!error.empty()) {
+      // The stream broke after some results arrived. The job can't be resent
+      // without duplicating them, so the job fails.
+      break;
+    }
+    recordJob(msg,
+              msgStr.size(),
+              received_messages,
+              received_bytes,
+              job_timer.elapsed());
     result.setJobType(JobMessage::SUCCESS);
     if (sock.is_open()) {
       sock.close();
     }
     return true;
   }
-  if (resultStr.empty()) {
-    resultStr = "MAX_TRIES reached";
+  if (error.empty()) {
+    error = "MAX_TRIES reached";
   }
-  logger_->warn(
-      utl::DST, 14, "Sending job failed with message \"{}\"", resultStr);
+  logger_->warn(utl::DST, 14, "Sending job failed with message \"{}\"", error);
   return false;
 }
 
+bool Distributed::reportJobFinished(const char* balancer_ip,
+                                    unsigned short balancer_port,
+                                    const std::string& worker_ip,
+                                    unsigned short worker_port,
+                                    double job_time)
+{
+  JobMessage msg(JobMessage::BALANCER_FINISH), result;
+  auto desc = std::make_unique<BalancerJobDescription>();
+  desc->setWorkerIP(worker_ip);
+  desc->setWorkerPort(worker_port);
+  desc->setJobTime(job_time);
+  msg.setJobDescription(std::move(desc));
+  return sendJob(msg, balancer_ip, balancer_port, result)
+         && result.getJobType() == JobMessage::SUCCESS;
+}
+
 bool Distributed::sendResult(JobMessage& msg, dst::socket& sock)
 {
   std::string msgStr;
@@ -248,6 +323,8 @@ bool Distributed::sendResult(JobMessage& msg, dst::socket& sock)
   std::string error;
   while (tries++ < MAX_TRIES) {
     if (sendMsg(sock, msgStr, error)) {
+      sent_messages_++;
+      sent_bytes_ += msgStr.size();
       return true;
     }
   }
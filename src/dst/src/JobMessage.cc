@@ -7,52 +7,182 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/unique_ptr.hpp>
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <lz4.h>
+#include <ostream>
+#include <streambuf>
 #include <string>
 
 #include "dst/BalancerJobDescription.h"
 
 using namespace dst;
 
-template <class Archive>
-inline bool is_loading(const Archive& ar)
+namespace {
+
+// Payloads smaller than this are sent uncompressed; lz4 wouldn't pay for
+// itself on the small control messages.
+constexpr std::size_t MIN_COMPRESS_SIZE = 64 * 1024;
+
+// Appends everything written to it to the frame string, so the archive is
+// built in place after the header instead of copied out of a stringstream.
+class FrameWriteBuf : public std::streambuf
+{
+ public:
+  explicit FrameWriteBuf(std::string& out) : out_(out) {}
+
+ protected:
+  int_type overflow(int_type ch) override
+  {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      out_.push_back(traits_type::to_char_type(ch));
+    }
+    return traits_type::not_eof(ch);
+  }
+  std::streamsize xsputn(const char* s, std::streamsize n) override
+  {
+    out_.append(s, n);
+    return n;
+  }
+
+ private:
+  std::string& out_;
+};
+
+// Reads the archive directly out of the received frame.
+class FrameReadBuf : public std::streambuf
 {
-  return std::is_same<typename Archive::is_loading, boost::mpl::true_>::value;
+ public:
+  FrameReadBuf(const char* data, std::size_t size)
+  {
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+  }
+};
+
+// Header fields are little endian regardless of the host.
+template <typename T>
+void putField(std::string& str, std::size_t offset, T value)
+{
+  for (std::size_t i = 0; i < sizeof(T); i++) {
+    str[offset + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
 }
 
+template <typename T>
+T getField(const char* header, std::size_t offset)
+{
+  T value = 0;
+  for (std::size_t i = 0; i < sizeof(T); i++) {
+    value |= static_cast<T>(static_cast<unsigned char>(header[offset + i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace
+
 template <class Archive>
 void JobMessage::serialize(Archive& ar, const unsigned int version)
 {
   (ar) & msg_type_;
   (ar) & job_type_;
   (ar) & desc_;
-  if (!is_loading(ar)) {
-    std::string eop = EOP;
-    (ar) & eop;
-  }
 }
 
 bool JobMessage::serializeMsg(SerializeType type,
                               JobMessage& msg,
                               std::string& str)
 {
-  if (type == WRITE) {
-    try {
-      std::ostringstream oarchive_stream;
-      boost::archive::text_oarchive archive(oarchive_stream);
-      archive << msg;
-      str = oarchive_stream.str();
-    } catch (const boost::archive::archive_exception& e) {
+  if (type == READ) {
+    return deserializeFrame(str.data(), str.size(), msg);
+  }
+  str.assign(FRAME_HEADER_SIZE, '\0');
+  try {
+    FrameWriteBuf buf(str);
+    std::ostream stream(&buf);
+    boost::archive::text_oarchive archive(stream);
+    archive << msg;
+  } catch (const boost::archive::archive_exception& e) {
+    return false;
+  }
+  const uint64_t raw_size = str.size() - FRAME_HEADER_SIZE;
+  if (raw_size > FRAME_MAX_PAYLOAD_SIZE) {
+    return false;
+  }
+  uint32_t flags = 0;
+  if (raw_size >= MIN_COMPRESS_SIZE && raw_size <= LZ4_MAX_INPUT_SIZE) {
+    const int bound = LZ4_compressBound(raw_size);
+    std::string packed(FRAME_HEADER_SIZE + bound, '\0');
+    const int packed_size
+        = LZ4_compress_default(str.data() + FRAME_HEADER_SIZE,
+                               packed.data() + FRAME_HEADER_SIZE,
+                               raw_size,
+                               bound);
+    if (packed_size > 0 && static_cast<uint64_t>(packed_size) < raw_size) {
+      packed.resize(FRAME_HEADER_SIZE + packed_size);
+      str.swap(packed);
+      flags |= FRAME_LZ4;
+    }
+  }
+  putField<uint32_t>(str, 0, FRAME_MAGIC);
+  putField<uint32_t>(str, 4, flags);
+  putField<uint64_t>(str, 8, raw_size);
+  putField<uint64_t>(str, 16, str.size() - FRAME_HEADER_SIZE);
+  return true;
+}
+
+bool JobMessage::getPayloadSize(const char* header, std::size_t& payload_size)
+{
+  if (getField<uint32_t>(header, 0) != FRAME_MAGIC) {
+    return false;
+  }
+  const uint64_t size = getField<uint64_t>(header, 16);
+  if (size > FRAME_MAX_PAYLOAD_SIZE) {
+    return false;
+  }
+  payload_size = size;
+  return true;
+}
+
+bool JobMessage::deserializeFrame(const char* frame,
+                                  std::size_t size,
+                                  JobMessage& msg)
+{
+  std::size_t payload_size;
+  if (size < FRAME_HEADER_SIZE || !getPayloadSize(frame, payload_size)
+      || payload_size != size - FRAME_HEADER_SIZE) {
+    return false;
+  }
+  const uint32_t flags = getField<uint32_t>(frame, 4);
+  const uint64_t raw_size = getField<uint64_t>(frame, 8);
+  const char* payload = frame + FRAME_HEADER_SIZE;
+  std::string raw;
+  if (flags & FRAME_LZ4) {
+    if (raw_size > FRAME_MAX_PAYLOAD_SIZE || raw_size > LZ4_MAX_INPUT_SIZE) {
       return false;
     }
-  } else {
-    try {
-      std::istringstream iarchive_stream(str);
-      boost::archive::text_iarchive archive(iarchive_stream);
-      archive >> msg;
-    } catch (const boost::archive::archive_exception& e) {
+    raw.resize(raw_size);
+    const int unpacked_size = LZ4_decompress_safe(
+        payload, raw.data(), payload_size, raw_size);
+    if (unpacked_size < 0
+        || static_cast<uint64_t>(unpacked_size) != raw_size) {
       return false;
     }
+    payload = raw.data();
+    payload_size = raw.size();
+  } else if (raw_size != payload_size) {
+    return false;
+  }
+  try {
+    FrameReadBuf buf(payload, payload_size);
+    std::istream stream(&buf);
+    boost::archive::text_iarchive archive(stream);
+    archive >> msg;
+  } catch (const std::exception& e) {
+    return false;
   }
   return true;
 }
@@ -3,6 +3,7 @@
 
 #include "LoadBalancer.h"
 
+#include <algorithm>
 #include <boost/bind/bind.hpp>
 #include <boost/thread/thread.hpp>
 #include <limits>
@@ -18,14 +19,12 @@ void LoadBalancer::start_accept()
 {
   if (jobs_ != 0 && jobs_ % 100 == 0) {
     logger_->info(utl::DST, 7, "Processed {} jobs", jobs_);
-    auto copy = workers_;
-    while (!copy.empty()) {
-      auto worker = copy.top();
+    std::lock_guard<std::mutex> lock(workers_mutex_);
+    for (const auto& worker : workers_) {
       logger_->report("Worker {}/{} handled {} jobs",
                       worker.ip,
                       worker.port,
-                      worker.priority);
-      copy.pop();
+                      worker.jobs);
     }
   }
   jobs_++;
@@ -71,7 +70,7 @@ bool LoadBalancer::addWorker(const std::string& ip, unsigned short port)
   std::lock_guard<std::mutex> lock(workers_mutex_);
   bool validWorkerState = true;
   if (!broadcastData.empty()) {
-    for (auto data : broadcastData) {
+    for (const auto& data : broadcastData) {
       try {
         asio::io_context service;
         tcp::socket socket(service);
@@ -91,52 +90,74 @@ bool LoadBalancer::addWorker(const std::string& ip, unsigned short port)
     }
   }
   if (validWorkerState) {
-    workers_.push(worker(ip::make_address(ip), port, 0));
+    workers_.emplace_back(ip::make_address(ip), port, 0);
   }
   return validWorkerState;
 }
-void LoadBalancer::updateWorker(const ip::address& ip, unsigned short port)
+
+LoadBalancer::worker* LoadBalancer::findWorker(const ip::address& ip,
+                                               unsigned short port)
 {
-  std::lock_guard<std::mutex> lock(workers_mutex_);
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
+  for (auto& worker : workers_) {
     if (worker.ip == ip && worker.port == port) {
-      worker.priority--;
+      return &worker;
     }
-    newQueue.push(worker);
   }
-  workers_.swap(newQueue);
+  return nullptr;
+}
+
+void LoadBalancer::updateWorker(const ip::address& ip, unsigned short port)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w != nullptr && w->priority != 0) {
+    w->priority--;
+  }
+}
+
+void LoadBalancer::finishJob(const ip::address& ip,
+                             unsigned short port,
+                             double job_time)
+{
+  // Weight of the last job in the moving average of the job time.
+  constexpr double job_time_weight = 0.25;
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w == nullptr) {
+    return;
+  }
+  if (w->priority != 0) {
+    w->priority--;
+  }
+  if (w->avg_job_time == 0) {
+    w->avg_job_time = job_time;
+  } else {
+    w->avg_job_time = job_time_weight * job_time
+                      + (1 - job_time_weight) * w->avg_job_time;
+  }
 }
+
 void LoadBalancer::getNextWorker(ip::address& ip, unsigned short& port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
   if (!workers_.empty()) {
-    worker w = workers_.top();
-    workers_.pop();
+    worker& w = *std::min_element(workers_.begin(), workers_.end());
     ip = w.ip;
     port = w.port;
     if (w.priority != std::numeric_limits<unsigned short>::max()) {
       w.priority++;
     }
-    workers_.push(w);
+    w.jobs++;
   }
 }
 
 void LoadBalancer::punishWorker(const ip::address& ip, unsigned short port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
-      worker.priority = worker.priority == 0 ? 2 : worker.priority * 2;
-    }
-    newQueue.push(worker);
+  worker* w = findWorker(ip, port);
+  if (w != nullptr) {
+    w->priority = w->priority == 0 ? 2 : w->priority * 2;
   }
-  workers_.swap(newQueue);
 }
 
 void LoadBalancer::removeWorker(const ip::address& ip,
@@ -146,16 +167,12 @@ void LoadBalancer::removeWorker(const ip::address& ip,
   if (lock) {
     workers_mutex_.lock();
   }
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
-      continue;
-    }
-    newQueue.push(worker);
-  }
-  workers_.swap(newQueue);
+  workers_.erase(std::remove_if(workers_.begin(),
+                                workers_.end(),
+                                [&](const worker& w) {
+                                  return w.ip == ip && w.port == port;
+                                }),
+                 workers_.end());
   if (lock) {
     workers_mutex_.unlock();
   }
@@ -9,7 +9,6 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -39,6 +38,9 @@ class LoadBalancer
   ~LoadBalancer();
   bool addWorker(const std::string& ip, unsigned short port);
   void updateWorker(const ip::address& ip, unsigned short port);
+  // Marks a job relayed or assigned to the worker as finished after job_time
+  // seconds.
+  void finishJob(const ip::address& ip, unsigned short port, double job_time);
   void getNextWorker(ip::address& ip, unsigned short& port);
   void removeWorker(const ip::address& ip,
                     unsigned short port,
@@ -50,7 +52,11 @@ class LoadBalancer
   {
     ip::address ip;
     unsigned short port;
+    // Jobs in flight on the worker, plus the penalty of failed relays.
     unsigned short priority;
+    uint32_t jobs{0};
+    // Moving average of the job time in seconds, 0 until a job finishes.
+    double avg_job_time{0};
     worker(ip::address ipIn, unsigned short portIn, unsigned short priorityIn)
         : ip(ipIn), port(portIn), priority(priorityIn)
     {
@@ -59,20 +65,24 @@ class LoadBalancer
     {
       return (ip == rhs.ip && port == rhs.port && priority == rhs.priority);
     }
-  };
-  struct CompareWorker
-  {
-    bool operator()(worker const& w1, worker const& w2)
+    // The least loaded worker is preferred. Among equally loaded workers the
+    // one with the highest measured throughput wins, so faster workers pull
+    // more jobs as they drain their queues sooner.
+    bool operator<(const worker& rhs) const
     {
-      return w1.priority > w2.priority;
+      if (priority != rhs.priority) {
+        return priority < rhs.priority;
+      }
+      return avg_job_time < rhs.avg_job_time;
     }
   };
+  worker* findWorker(const ip::address& ip, unsigned short port);
 
   Distributed* dist_;
   tcp::acceptor acceptor_;
   asio::io_context* service_;
   utl::Logger* logger_;
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> workers_;
+  std::vector<worker> workers_;
   std::mutex workers_mutex_;
   std::unique_ptr<asio::thread_pool> pool_;
   std::mutex pool_mutex_;
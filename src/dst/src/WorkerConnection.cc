@@ -34,10 +34,40 @@ tcp::socket& WorkerConnection::socket()
 
 void WorkerConnection::start()
 {
-  async_read_until(
+  in_packet_.resize(JobMessage::FRAME_HEADER_SIZE);
+  asio::async_read(
       sock_,
-      in_packet_,
-      JobMessage::EOP,
+      asio::buffer(in_packet_),
+      [me = shared_from_this()](boost::system::error_code const& ec,
+                                std::size_t bytes_xfer) {
+        me->handle_header(ec, bytes_xfer);
+      });
+}
+
+void WorkerConnection::handle_header(boost::system::error_code const& err,
+                                     size_t bytes_transferred)
+{
+  if (err) {
+    handle_read(err, bytes_transferred);
+    return;
+  }
+  std::size_t payload_size;
+  if (!JobMessage::getPayloadSize(in_packet_.data(), payload_size)) {
+    boost::system::error_code error;
+    logger_->warn(utl::DST,
+                  41,
+                  "Received malformed msg of {} bytes from port {}",
+                  in_packet_.size(),
+                  sock_.remote_endpoint().port());
+    asio::write(sock_, asio::buffer("0"), error);
+    sock_.close();
+    return;
+  }
+  in_packet_.resize(JobMessage::FRAME_HEADER_SIZE + payload_size);
+  asio::async_read(
+      sock_,
+      asio::buffer(in_packet_.data() + JobMessage::FRAME_HEADER_SIZE,
+                   payload_size),
       [me = shared_from_this()](boost::system::error_code const& ec,
                                 std::size_t bytes_xfer) {
         me->handle_read(ec, bytes_xfer);
@@ -48,19 +78,20 @@ void WorkerConnection::handle_read(boost::system::error_code const& err,
                                    size_t bytes_transferred)
 {
   if (!err) {
-    std::string data{buffers_begin(in_packet_.data()),
-                     buffers_begin(in_packet_.data()) + bytes_transferred};
     boost::system::error_code error;
-    if (!JobMessage::serializeMsg(JobMessage::READ, msg_, data)) {
+    if (!JobMessage::deserializeFrame(
+            in_packet_.data(), in_packet_.size(), msg_)) {
       logger_->warn(utl::DST,
                     41,
-                    "Received malformed msg {} from port {}",
-                    data,
+                    "Received malformed msg of {} bytes from port {}",
+                    in_packet_.size(),
                     sock_.remote_endpoint().port());
       asio::write(sock_, asio::buffer("0"), error);
       sock_.close();
       return;
     }
+    // The request is no longer needed once deserialized.
+    std::string().swap(in_packet_);
     switch (msg_.getJobType()) {
       case JobMessage::ROUTING:
         for (auto& cb : dist_->getCallBacks()) {
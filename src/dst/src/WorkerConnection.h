@@ -8,6 +8,7 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/make_shared.hpp>
 #include <cstddef>
+#include <string>
 namespace asio = boost::asio;
 using asio::ip::tcp;
 namespace utl {
@@ -25,6 +26,8 @@ class WorkerConnection : public boost::enable_shared_from_this<WorkerConnection>
                    Worker* worker);
   tcp::socket& socket();
   void start();
+  void handle_header(boost::system::error_code const& err,
+                     size_t bytes_transferred);
   void handle_read(boost::system::error_code const& err,
                    size_t bytes_transferred);
   Worker* getWorker() const { return worker_; }
@@ -32,7 +35,7 @@ class WorkerConnection : public boost::enable_shared_from_this<WorkerConnection>
  private:
   tcp::socket sock_;
   Distributed* dist_;
-  asio::streambuf in_packet_;
+  std::string in_packet_;
   utl::Logger* logger_;
   JobMessage msg_;
   Worker* worker_;
@@ -1,5 +1,6 @@
 #define BOOST_TEST_MODULE TestBalancer
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <boost/test/included/unit_test.hpp>
 #include <boost/thread/thread.hpp>
@@ -7,13 +8,41 @@
 
 #include "HelperCallBack.h"
 #include "LoadBalancer.h"
+#include "dst/BalancerJobDescription.h"
 #include "dst/BroadcastJobDescription.h"
 #include "dst/Distributed.h"
 #include "dst/JobMessage.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 using namespace dst;
 
+namespace {
+
+// Answers every routing job after sleeping for a fixed time.
+class SleepCallBack : public HelperCallBack
+{
+ public:
+  SleepCallBack(Distributed* dist, int job_msecs, std::atomic<int>& jobs)
+      : HelperCallBack(dist), dist_(dist), job_msecs_(job_msecs), jobs_(jobs)
+  {
+  }
+  void onRoutingJobReceived(JobMessage& msg, dst::socket& sock) override
+  {
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(job_msecs_));
+    jobs_++;
+    JobMessage reply(JobMessage::JobType::SUCCESS);
+    dist_->sendResult(reply, sock);
+  }
+
+ private:
+  Distributed* dist_;
+  const int job_msecs_;
+  std::atomic<int>& jobs_;
+};
+
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(test_suite)
 
 BOOST_AUTO_TEST_CASE(test_default)
@@ -105,4 +134,74 @@ BOOST_AUTO_TEST_CASE(test_default)
   // history i.e have invalid state.
   BOOST_TEST(balancer->addWorker(local_ip, worker_port_2) == false);
 }
+
+BOOST_AUTO_TEST_CASE(test_throughput)
+{
+  // Two real workers of different speeds are fed through the BALANCER path:
+  // the client asks the balancer for a worker, sends the job there directly
+  // and reports its completion back. The faster worker must end up with the
+  // larger share of the jobs.
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  Distributed* slow_dist = new Distributed(logger);
+  Distributed* fast_dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short balancer_port = 5565;
+  unsigned short slow_port = 5566;
+  unsigned short fast_port = 5567;
+  std::atomic<int> slow_jobs = 0;
+  std::atomic<int> fast_jobs = 0;
+  slow_dist->addCallBack(new SleepCallBack(slow_dist, 100, slow_jobs));
+  fast_dist->addCallBack(new SleepCallBack(fast_dist, 5, fast_jobs));
+  slow_dist->runWorker(local_ip.c_str(), slow_port, true);
+  fast_dist->runWorker(local_ip.c_str(), fast_port, true);
+
+  asio::io_context service;
+  LoadBalancer* balancer = new LoadBalancer(
+      dist, service, logger, local_ip.c_str(), "", balancer_port);
+  // The slow worker is added first so it wins ties while nothing is measured.
+  BOOST_TEST(balancer->addWorker(local_ip, slow_port));
+  BOOST_TEST(balancer->addWorker(local_ip, fast_port));
+  boost::thread t(boost::bind(&asio::io_context::run, &service));
+
+  const int clients = 4;
+  const int jobs_per_client = 10;
+  std::atomic<int> failures = 0;
+  boost::thread_group client_threads;
+  for (int i = 0; i < clients; i++) {
+    client_threads.create_thread([&]() {
+      for (int j = 0; j < jobs_per_client; j++) {
+        JobMessage msg(JobMessage::JobType::BALANCER);
+        JobMessage result;
+        if (!dist->sendJob(msg, local_ip.c_str(), balancer_port, result)
+            || result.getJobType() != JobMessage::JobType::SUCCESS) {
+          failures++;
+          continue;
+        }
+        auto desc
+            = static_cast<BalancerJobDescription*>(result.getJobDescription());
+        const std::string worker_ip = desc->getWorkerIP();
+        const unsigned short worker_port = desc->getWorkerPort();
+        const utl::Timer job_timer;
+        JobMessage job(JobMessage::JobType::ROUTING);
+        JobMessage job_result;
+        if (!dist->sendJob(job, worker_ip.c_str(), worker_port, job_result)) {
+          failures++;
+        }
+        if (!dist->reportJobFinished(local_ip.c_str(),
+                                     balancer_port,
+                                     worker_ip,
+                                     worker_port,
+                                     job_timer.elapsed())) {
+          failures++;
+        }
+      }
+    });
+  }
+  client_threads.join_all();
+
+  BOOST_TEST(failures == 0);
+  BOOST_TEST(slow_jobs + fast_jobs == clients * jobs_per_client);
+  BOOST_TEST(fast_jobs > 2 * slow_jobs);
+}
 BOOST_AUTO_TEST_SUITE_END()
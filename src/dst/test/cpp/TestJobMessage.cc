@@ -0,0 +1,230 @@
+#define BOOST_TEST_MODULE TestJobMessage
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <boost/test/included/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "HelperCallBack.h"
+#include "dst/BalancerJobDescription.h"
+#include "dst/Distributed.h"
+#include "dst/JobMessage.h"
+#include "utl/Logger.h"
+
+using namespace dst;
+
+namespace {
+
+// Matches JobMessage::FRAME_MAGIC, used to hand craft frame headers.
+constexpr uint32_t frame_magic = 0x46545344;
+constexpr std::size_t frame_header_size = 24;
+
+// Sends the job description of every routing job back to the sender.
+class EchoCallBack : public HelperCallBack
+{
+ public:
+  EchoCallBack(Distributed* dist) : HelperCallBack(dist), dist_(dist) {}
+  void onRoutingJobReceived(JobMessage& msg, dst::socket& sock) override
+  {
+    JobMessage reply(JobMessage::JobType::SUCCESS);
+    reply.setJobDescription(std::move(msg.getJobDescriptionRef()));
+    dist_->sendResult(reply, sock);
+  }
+
+ private:
+  Distributed* dist_;
+};
+
+// Frame header fields are little endian.
+void putField(std::string& header,
+              std::size_t offset,
+              std::size_t size,
+              uint64_t value)
+{
+  for (std::size_t i = 0; i < size; i++) {
+    header[offset + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+}
+
+std::string makeHeader(uint64_t raw_size, uint64_t payload_size)
+{
+  std::string header(frame_header_size, '\0');
+  putField(header, 0, 4, frame_magic);
+  putField(header, 4, 4, 0);
+  putField(header, 8, 8, raw_size);
+  putField(header, 16, 8, payload_size);
+  return header;
+}
+
+// Reads one request frame so the peer is done writing before we answer.
+void readRequest(dst::socket& sock)
+{
+  std::string header(frame_header_size, '\0');
+  asio::read(sock, asio::buffer(header));
+  uint64_t payload_size = 0;
+  for (std::size_t i = 0; i < 8; i++) {
+    payload_size |= uint64_t(static_cast<unsigned char>(header[16 + i]))
+                    << (8 * i);
+  }
+  std::string payload(payload_size, '\0');
+  asio::read(sock, asio::buffer(payload));
+}
+
+// Answers every connection on port with respond() until the test exits.
+void serve(unsigned short port, std::function<void(dst::socket&)> respond)
+{
+  boost::thread server([port, respond]() {
+    asio::io_context service;
+    tcp::acceptor acceptor(service,
+                           tcp::endpoint(asio::ip::tcp::v4(), port));
+    while (true) {
+      dst::socket sock(service);
+      acceptor.accept(sock);
+      try {
+        readRequest(sock);
+        respond(sock);
+      } catch (const std::exception&) {
+      }
+      sock.close();
+    }
+  });
+  server.detach();
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+}
+
+JobMessage makeJob(const std::string& payload)
+{
+  JobMessage msg(JobMessage::JobType::ROUTING);
+  auto desc = std::make_unique<BalancerJobDescription>();
+  desc->setWorkerIP(payload);
+  msg.setJobDescription(std::move(desc));
+  return msg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_round_trip)
+{
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short worker_port = 5575;
+  dist->addCallBack(new EchoCallBack(dist));
+  dist->runWorker(local_ip.c_str(), worker_port, true);
+
+  // A small message goes uncompressed and a large one crosses the lz4
+  // threshold; both must come back unchanged.
+  for (const std::size_t size : {100, 1 << 20}) {
+    std::string payload(size, 'a');
+    for (std::size_t i = 0; i < size; i += 7) {
+      payload[i] = 'a' + (i % 26);
+    }
+    const Distributed::MessageStats before = dist->getMessageStats();
+    JobMessage msg = makeJob(payload);
+    JobMessage result;
+    BOOST_TEST(dist->sendJob(msg, local_ip.c_str(), worker_port, result));
+    BOOST_TEST(result.getJobType() == JobMessage::JobType::SUCCESS);
+    auto desc
+        = dynamic_cast<BalancerJobDescription*>(result.getJobDescription());
+    BOOST_TEST(desc != nullptr);
+    if (desc != nullptr) {
+      BOOST_TEST(desc->getWorkerIP() == payload);
+    }
+    const Distributed::MessageStats after = dist->getMessageStats();
+    const uint64_t sent = after.sent_bytes - before.sent_bytes;
+    if (size < 1000) {
+      BOOST_TEST(sent > size);
+    } else {
+      BOOST_TEST(sent < size / 2);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_truncated_result)
+{
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short port = 5576;
+  // The header announces more payload than is sent before the close.
+  serve(port, [](dst::socket& sock) {
+    asio::write(sock, asio::buffer(makeHeader(100, 100) + "0123456789"));
+  });
+  JobMessage msg = makeJob("job");
+  JobMessage result;
+  BOOST_TEST(!dist->sendJob(msg, local_ip.c_str(), port, result));
+}
+
+BOOST_AUTO_TEST_CASE(test_oversized_result)
+{
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short port = 5577;
+  serve(port, [](dst::socket& sock) {
+    asio::write(sock, asio::buffer(makeHeader(1ULL << 40, 1ULL << 40)));
+  });
+  JobMessage msg = makeJob("job");
+  JobMessage result;
+  BOOST_TEST(!dist->sendJob(msg, local_ip.c_str(), port, result));
+}
+
+BOOST_AUTO_TEST_CASE(test_multi_result_broken_stream)
+{
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  Distributed* server_dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short port = 5578;
+  std::atomic<int> connections = 0;
+  // One complete result followed by a truncated one.
+  serve(port, [server_dist, &connections](dst::socket& sock) {
+    connections++;
+    JobMessage reply = makeJob("result");
+    server_dist->sendResult(reply, sock);
+    asio::write(sock, asio::buffer(makeHeader(100, 100) + "0123456789"));
+  });
+  JobMessage msg = makeJob("job");
+  JobMessage result;
+  BOOST_TEST(!dist->sendJobMultiResult(msg, local_ip.c_str(), port, result));
+  // The job is not resent once results have arrived.
+  BOOST_TEST(connections == 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_worker_rejects_oversized_frame)
+{
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short worker_port = 5579;
+  dist->addCallBack(new EchoCallBack(dist));
+  dist->runWorker(local_ip.c_str(), worker_port, true);
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+
+  // The worker must refuse the frame from its header alone rather than
+  // allocating the announced payload.
+  asio::io_context service;
+  dst::socket sock(service);
+  sock.connect(
+      tcp::endpoint(asio::ip::make_address(local_ip), worker_port));
+  asio::write(sock, asio::buffer(makeHeader(1ULL << 40, 1ULL << 40)));
+  std::string reply;
+  boost::system::error_code ec;
+  asio::read(sock, asio::dynamic_buffer(reply), ec);
+  BOOST_TEST(ec == asio::error::eof);
+  BOOST_TEST(reply.substr(0, 1) == "0");
+
+  // The worker keeps serving well formed jobs.
+  JobMessage msg = makeJob("job");
+  JobMessage result;
+  BOOST_TEST(dist->sendJob(msg, local_ip.c_str(), worker_port, result));
+  BOOST_TEST(result.getJobType() == JobMessage::JobType::SUCCESS);
+}
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,7 +20,10 @@ class Finale
  public:
   void init(odb::dbDatabase* db, Logger* logger);
 
-  void densityFill(const char* rules_filename, const odb::Rect& fill_area);
+  void densityFill(const char* rules_filename,
+                   const odb::Rect& fill_area,
+                   int tile_size = 0,
+                   int threads = 1);
 
   void setDebug();
 
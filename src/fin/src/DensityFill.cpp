@@ -4,19 +4,25 @@
 #include "DensityFill.h"
 
 #include <algorithm>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/lexical_cast.hpp>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "graphics.h"
 #include "odb/dbShape.h"
+#include "odb/geom.h"
+#include "odb/geom_boost.h"
+#include "utl/exception.h"
 
 namespace fin {
 
 using utl::FIN;
 
 namespace pt = boost::property_tree;
+namespace bgi = boost::geometry::index;
 
 using namespace odb;
 
@@ -42,6 +48,27 @@ struct DensityFillLayerConfig
   DensityFillShapesConfig non_opc;
 };
 
+// A fill shape to insert into the block
+struct FillShape
+{
+  Rect rect;
+  int mask;
+  bool needs_opc;
+};
+
+// The fills found in one area of a layer
+struct AreaFills
+{
+  int non_opc_polygons = 0;
+  int opc_polygons = 0;
+  std::vector<FillShape> non_opc;
+  std::vector<FillShape> opc;
+};
+
+// Tiles filled in parallel per thread before their fills are inserted.
+// This bounds the memory used by tiled fill.
+constexpr int kTilesPerThread = 4;
+
 // Make a boost polygon representing a rectangle
 static Polygon90 makeRect(int x_lo, int y_lo, int x_hi, int y_hi)
 {
@@ -176,11 +203,12 @@ void DensityFill::loadConfig(const char* cfg_filename, dbTech* tech)
   readAndExpandLayers(tech, tree);
 }
 
-// Insert into polygon_set any part of given shape on the given layer (shape may
-// be a via)
+// Insert into rects any part of given shape on the given layer that
+// touches area (shape may be a via)
 static void insertShape(const dbShape& shape,
-                        Polygon90Set& polygon_set,
-                        dbTechLayer* layer)
+                        std::vector<Rect>& rects,
+                        dbTechLayer* layer,
+                        const Rect& area)
 {
   auto type = shape.getType();
   switch (type) {
@@ -204,35 +232,30 @@ static void insertShape(const dbShape& shape,
       std::vector<dbShape> boxes;
       dbShape::getViaBoxes(shape, boxes);
       for (auto& box : boxes) {
-        if (box.getTechLayer() == layer) {
-          polygon_set.insert(
-              makeRect(box.xMin(), box.yMin(), box.xMax(), box.yMax()));
+        if (box.getTechLayer() == layer && box.getBox().intersects(area)) {
+          rects.push_back(box.getBox());
         }
       }
       break;
     }
     case dbShape::SEGMENT:
-      if (shape.getTechLayer() == layer) {
-        polygon_set.insert(
-            makeRect(shape.xMin(), shape.yMin(), shape.xMax(), shape.yMax()));
-      }
-      break;
     case dbShape::TECH_VIA_BOX:
     case dbShape::VIA_BOX:
-      if (shape.getTechLayer() == layer) {
-        polygon_set.insert(
-            makeRect(shape.xMin(), shape.yMin(), shape.xMax(), shape.yMax()));
+      if (shape.getTechLayer() == layer && shape.getBox().intersects(area)) {
+        rects.push_back(shape.getBox());
       }
       break;
   }
 }
 
-// Build a polygon set out of all the non-fill shape on the given layer
-// including wires, special wires, and instances' pins & OBS
-static Polygon90Set orNonFills(dbBlock* block, dbTechLayer* layer)
+// Collect the non-fill shapes on the given layer that touch area including
+// wires, special wires, and instances' pins & OBS
+static std::vector<Rect> getNonFills(dbBlock* block,
+                                     dbTechLayer* layer,
+                                     const Rect& area)
 {
-  Polygon90Set non_fill;  // The result
-  dbShape shape;          // Shared temp
+  std::vector<Rect> non_fill;  // The result
+  dbShape shape;               // Shared temp
 
   // Get shapes from regular wires
   dbWireShapeItr shapes;
@@ -242,7 +265,7 @@ static Polygon90Set orNonFills(dbBlock* block, dbTechLayer* layer)
       continue;
     }
     for (shapes.begin(wire); shapes.next(shape);) {
-      insertShape(shape, non_fill, layer);
+      insertShape(shape, non_fill, layer, area);
     }
   }
 
@@ -257,11 +280,11 @@ static Polygon90Set orNonFills(dbBlock* block, dbTechLayer* layer)
           shape.setVia(via, rect);
           dbShape::getViaBoxes(shape, via_shapes);
           for (auto& via_shape : via_shapes) {
-            insertShape(via_shape, non_fill, layer);
+            insertShape(via_shape, non_fill, layer, area);
           }
-        } else if (sbox->getTechLayer() == layer) {
-          non_fill.insert(
-              makeRect(sbox->xMin(), sbox->yMin(), sbox->xMax(), sbox->yMax()));
+        } else if (sbox->getTechLayer() == layer
+                   && sbox->getBox().intersects(area)) {
+          non_fill.push_back(sbox->getBox());
         }
       }
     }
@@ -271,13 +294,24 @@ static Polygon90Set orNonFills(dbBlock* block, dbTechLayer* layer)
   dbInstShapeItr insts(/* expand_vias */ false);
   for (auto inst : block->getInsts()) {
     for (insts.begin(inst, dbInstShapeItr::ALL); insts.next(shape);) {
-      insertShape(shape, non_fill, layer);
+      insertShape(shape, non_fill, layer, area);
     }
   }
 
   return non_fill;
 }
 
+// Build a polygon set out of the non-fill shapes
+static Polygon90Set orNonFills(const std::vector<Rect>& non_fills)
+{
+  Polygon90Set non_fill;
+  for (const Rect& rect : non_fills) {
+    non_fill.insert(
+        makeRect(rect.xMin(), rect.yMin(), rect.xMax(), rect.yMax()));
+  }
+  return non_fill;
+}
+
 static std::pair<int, int> getSpacing(dbTechLayer* layer,
                                       const DensityFillShapesConfig& cfg)
 {
@@ -293,6 +327,26 @@ static std::pair<int, int> getSpacing(dbTechLayer* layer,
   return std::make_pair(space_x, space_y);
 }
 
+// The distance within which non-fill shapes keep fill away
+static int getNonFillHalo(const DensityFillLayerConfig& cfg)
+{
+  int halo = cfg.non_opc.space_to_non_fill;
+  if (cfg.has_opc) {
+    halo = std::max(halo, cfg.opc.space_to_non_fill);
+  }
+  return halo;
+}
+
+// The largest width or height of the fill shapes
+static int getMaxFillSize(const DensityFillShapesConfig& cfg)
+{
+  int size = 0;
+  for (const auto& [width, height] : cfg.shapes) {
+    size = std::max({size, width, height});
+  }
+  return size;
+}
+
 // Two different polygons might be less than min space apart and this
 // can lead to DRVs when they are filled independently.  To avoid this
 // we exclude a min-space area around each polygon.  This is somewhat
@@ -314,16 +368,17 @@ static void prune(Polygon90Set& fill_area,
   fill_area -= pruned;
 }
 
-// Fill a polygon (area) on the given layer using the given configuration.
+// Fill a polygon (area) on the given layer using the given configuration
+// adding the generated fills to fill_shapes.
 // Num_masks is used to color the generated fills.
 // filled_area, if given, is an OR of the generated fills without bloating
 static void fillPolygon(const Polygon90& area,
                         dbTechLayer* layer,
-                        dbBlock* block,
                         const DensityFillShapesConfig& cfg,
                         int num_masks,
                         bool needs_opc,
                         Graphics* graphics,
+                        std::vector<FillShape>& fill_shapes,
                         Polygon90Set* filled_area = nullptr)
 {
   // Convert the area polygon to a polygon set as we will remove areas
@@ -388,7 +443,7 @@ static void fillPolygon(const Polygon90& area,
       Polygon90Set tmp_fills(fills);
       all_iter_fills += bloat(tmp_fills, space_x, space_x, space_y, space_y);
 
-      // Insert fills into the db
+      // Collect the fills for the db
       std::vector<Rectangle> polygons;
       fills.get_rectangles(polygons);
       const int num_mask = std::max(num_masks, 1);
@@ -404,7 +459,7 @@ static void fillPolygon(const Polygon90& area,
         auto y_lo = yl(f);
         auto x_hi = xh(f);
         auto y_hi = yh(f);
-        dbFill::create(block, needs_opc, mask, layer, x_lo, y_lo, x_hi, y_hi);
+        fill_shapes.push_back({Rect(x_lo, y_lo, x_hi, y_hi), mask, needs_opc});
         if (filled_area) {
           *filled_area += makeRect(x_lo, y_lo, x_hi, y_hi);
         }
@@ -415,50 +470,42 @@ static void fillPolygon(const Polygon90& area,
   }
 }
 
-// Fill the given layer
-void DensityFill::fillLayer(dbBlock* block,
-                            dbTechLayer* layer,
-                            const odb::Rect& fill_bounds_rect)
+// Find the fills for the fill bounds on the given layer avoiding the
+// non-fill shapes
+static void fillArea(const Polygon90& fill_bounds,
+                     const Polygon90Set& non_fill,
+                     dbTechLayer* layer,
+                     const DensityFillLayerConfig& cfg,
+                     Graphics* graphics,
+                     AreaFills& fills)
 {
-  logger_->info(FIN, 3, "Filling layer {}.", layer->getConstName());
-
-  Polygon90Set non_fill = orNonFills(block, layer);
-
-  auto fill_bounds = makeRect(fill_bounds_rect.xMin(),
-                              fill_bounds_rect.yMin(),
-                              fill_bounds_rect.xMax(),
-                              fill_bounds_rect.yMax());
-
-  const DensityFillLayerConfig& cfg = layers_[layer];
-
   std::vector<Polygon90> polygons;
 
   // Do non-OPC fill
   Polygon90Set fill_area
       = fill_bounds - (non_fill + cfg.non_opc.space_to_non_fill);
 
-  if (graphics_) {
-    graphics_->status("Non-OPC Area");
-    graphics_->drawPolygon90Set(fill_area);
+  if (graphics) {
+    graphics->status("Non-OPC Area");
+    graphics->drawPolygon90Set(fill_area);
   }
 
-  prune(fill_area, layer, cfg.non_opc, graphics_.get());
+  prune(fill_area, layer, cfg.non_opc, graphics);
 
   fill_area.get(polygons);
-  logger_->info(FIN, 9, "Filling {} areas with non-OPC fill.", polygons.size());
+  fills.non_opc_polygons = polygons.size();
 
   Polygon90Set non_opc_fill_area;
   for (auto& polygon : polygons) {
     fillPolygon(polygon,
                 layer,
-                block,
                 cfg.non_opc,
                 cfg.num_masks,
                 false,
-                graphics_.get(),
+                graphics,
+                fills.non_opc,
                 &non_opc_fill_area);
   }
-  logger_->info(FIN, 4, "Total fills: {}.", block->getFills().size());
 
   if (!cfg.has_opc) {
     return;
@@ -468,31 +515,234 @@ void DensityFill::fillLayer(dbBlock* block,
       = fill_bounds - (non_fill + cfg.opc.space_to_non_fill)
         - (non_opc_fill_area + cfg.non_opc.space_to_fill);
 
-  if (graphics_) {
-    graphics_->status("OPC Area");
-    graphics_->drawPolygon90Set(opc_fill_area);
+  if (graphics) {
+    graphics->status("OPC Area");
+    graphics->drawPolygon90Set(opc_fill_area);
   }
 
-  prune(opc_fill_area, layer, cfg.opc, graphics_.get());
+  prune(opc_fill_area, layer, cfg.opc, graphics);
 
   polygons.clear();
   opc_fill_area.get(polygons);
-  logger_->info(FIN, 5, "Filling {} areas with OPC fill.", polygons.size());
+  fills.opc_polygons = polygons.size();
   for (auto& polygon : polygons) {
-    fillPolygon(
-        polygon, layer, block, cfg.opc, cfg.num_masks, true, graphics_.get());
+    fillPolygon(polygon,
+                layer,
+                cfg.opc,
+                cfg.num_masks,
+                true,
+                graphics,
+                fills.opc);
   }
 
+  if (graphics) {
+    graphics->status("OPC Area");
+    graphics->drawPolygon90Set(opc_fill_area);
+  }
+}
+
+static void insertFills(dbBlock* block,
+                        dbTechLayer* layer,
+                        const std::vector<FillShape>& fills)
+{
+  for (const FillShape& fill : fills) {
+    const Rect& rect = fill.rect;
+    dbFill::create(block,
+                   fill.needs_opc,
+                   fill.mask,
+                   layer,
+                   rect.xMin(),
+                   rect.yMin(),
+                   rect.xMax(),
+                   rect.yMax());
+  }
+}
+
+// Fill the given layer
+void DensityFill::fillLayer(dbBlock* block,
+                            dbTechLayer* layer,
+                            const odb::Rect& fill_bounds_rect,
+                            int tile_size,
+                            int threads)
+{
+  logger_->info(FIN, 3, "Filling layer {}.", layer->getConstName());
+
+  if (tile_size > 0) {
+    fillLayerTiles(block, layer, fill_bounds_rect, tile_size, threads);
+    return;
+  }
+
+  const DensityFillLayerConfig& cfg = layers_[layer];
+
+  // Shapes farther away than the non-fill spacing don't affect the fill
+  Rect non_fill_area;
+  fill_bounds_rect.bloat(getNonFillHalo(cfg), non_fill_area);
+  Polygon90Set non_fill
+      = orNonFills(getNonFills(block, layer, non_fill_area));
+
+  auto fill_bounds = makeRect(fill_bounds_rect.xMin(),
+                              fill_bounds_rect.yMin(),
+                              fill_bounds_rect.xMax(),
+                              fill_bounds_rect.yMax());
+
+  AreaFills fills;
+  fillArea(fill_bounds, non_fill, layer, cfg, graphics_.get(), fills);
+
+  logger_->info(
+      FIN, 9, "Filling {} areas with non-OPC fill.", fills.non_opc_polygons);
+  insertFills(block, layer, fills.non_opc);
+  logger_->info(FIN, 4, "Total fills: {}.", block->getFills().size());
+
+  if (!cfg.has_opc) {
+    return;
+  }
+
+  logger_->info(FIN, 5, "Filling {} areas with OPC fill.", fills.opc_polygons);
+  insertFills(block, layer, fills.opc);
   logger_->info(FIN, 6, "Total fills: {}.", block->getFills().size());
+}
 
-  if (graphics_) {
-    graphics_->status("OPC Area");
-    graphics_->drawPolygon90Set(opc_fill_area);
+// Fill the given layer one tile at a time.  The tiles are filled in
+// parallel a strip of tile rows at a time.  The layer's non-fill shapes are
+// collected once into an rtree and each tile builds the polygon set of only
+// the shapes near it.
+void DensityFill::fillLayerTiles(dbBlock* block,
+                                 dbTechLayer* layer,
+                                 const odb::Rect& fill_bounds,
+                                 int tile_size,
+                                 int threads)
+{
+  const DensityFillLayerConfig& cfg = layers_[layer];
+
+  // Non-fill shapes this close to a tile keep fill out of it
+  const int halo = getNonFillHalo(cfg);
+  // Fills in neighboring tiles are kept apart by leaving half the fill
+  // spacing on each side of the edges between tiles
+  auto [space_x, space_y] = getSpacing(layer, cfg.non_opc);
+  int max_fill = getMaxFillSize(cfg.non_opc);
+  if (cfg.has_opc) {
+    auto [opc_space_x, opc_space_y] = getSpacing(layer, cfg.opc);
+    space_x = std::max(space_x, opc_space_x);
+    space_y = std::max(space_y, opc_space_y);
+    max_fill = std::max(max_fill, getMaxFillSize(cfg.opc));
   }
+  const int edge_x = (space_x + 1) / 2;
+  const int edge_y = (space_y + 1) / 2;
+
+  // A tile must hold the largest fill between its edges
+  const int min_tile_size = 2 * std::max(edge_x, edge_y) + max_fill;
+  if (tile_size < min_tile_size) {
+    logger_->warn(FIN,
+                  13,
+                  "Tile size {:.3f} is too small for layer {}, using {:.3f}.",
+                  block->dbuToMicrons(tile_size),
+                  layer->getConstName(),
+                  block->dbuToMicrons(min_tile_size));
+    tile_size = min_tile_size;
+  }
+
+  // The tiles by row
+  std::vector<std::vector<Rect>> rows;
+  for (int y = fill_bounds.yMin(); y < fill_bounds.yMax(); y += tile_size) {
+    std::vector<Rect>& row = rows.emplace_back();
+    for (int x = fill_bounds.xMin(); x < fill_bounds.xMax(); x += tile_size) {
+      Rect tile(x,
+                y,
+                std::min(x + tile_size, fill_bounds.xMax()),
+                std::min(y + tile_size, fill_bounds.yMax()));
+      if (tile.xMin() > fill_bounds.xMin()) {
+        tile.set_xlo(tile.xMin() + edge_x);
+      }
+      if (tile.xMax() < fill_bounds.xMax()) {
+        tile.set_xhi(tile.xMax() - edge_x);
+      }
+      if (tile.yMin() > fill_bounds.yMin()) {
+        tile.set_ylo(tile.yMin() + edge_y);
+      }
+      if (tile.yMax() < fill_bounds.yMax()) {
+        tile.set_yhi(tile.yMax() - edge_y);
+      }
+      if (tile.dx() > 0 && tile.dy() > 0) {
+        row.push_back(tile);
+      }
+    }
+  }
+
+  // Shapes farther away than the non-fill spacing don't affect the fill
+  Rect non_fill_area;
+  fill_bounds.bloat(halo, non_fill_area);
+  const std::vector<Rect> non_fill_rects
+      = getNonFills(block, layer, non_fill_area);
+  const bgi::rtree<Rect, bgi::quadratic<16>> non_fills(non_fill_rects.begin(),
+                                                       non_fill_rects.end());
+
+  int num_tiles = 0;
+  int non_opc_polygons = 0;
+  int opc_polygons = 0;
+  const std::size_t batch_size = std::max(threads, 1) * kTilesPerThread;
+  std::vector<Rect> tiles;
+  std::vector<AreaFills> batch_fills;
+  for (std::size_t next_row = 0; next_row < rows.size();) {
+    // Take whole rows up to the batch size
+    tiles.clear();
+    do {
+      tiles.insert(tiles.end(), rows[next_row].begin(), rows[next_row].end());
+      next_row++;
+    } while (next_row < rows.size()
+             && tiles.size() + rows[next_row].size() <= batch_size);
+    if (tiles.empty()) {
+      continue;
+    }
+    num_tiles += tiles.size();
+
+    batch_fills.clear();
+    batch_fills.resize(tiles.size());
+
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for (std::size_t i = 0; i < tiles.size(); i++) {
+      try {
+        const Rect& tile = tiles[i];
+        Rect query;
+        tile.bloat(halo, query);
+        Polygon90Set non_fill;
+        for (auto it = non_fills.qbegin(bgi::intersects(query));
+             it != non_fills.qend();
+             ++it) {
+          non_fill.insert(
+              makeRect(it->xMin(), it->yMin(), it->xMax(), it->yMax()));
+        }
+        const Polygon90 fill_area
+            = makeRect(tile.xMin(), tile.yMin(), tile.xMax(), tile.yMax());
+        fillArea(fill_area, non_fill, layer, cfg, nullptr, batch_fills[i]);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    for (const AreaFills& fills : batch_fills) {
+      non_opc_polygons += fills.non_opc_polygons;
+      opc_polygons += fills.opc_polygons;
+      insertFills(block, layer, fills.non_opc);
+      insertFills(block, layer, fills.opc);
+    }
+  }
+
+  logger_->info(FIN,
+                11,
+                "Filled {} tiles with {} non-OPC and {} OPC areas.",
+                num_tiles,
+                non_opc_polygons,
+                opc_polygons);
+  logger_->info(FIN, 12, "Total fills: {}.", block->getFills().size());
 }
 
 // Fill the design according to the given cfg file
-void DensityFill::fill(const char* cfg_filename, const odb::Rect& fill_area)
+void DensityFill::fill(const char* cfg_filename,
+                       const odb::Rect& fill_area,
+                       int tile_size,
+                       int threads)
 {
   dbTech* tech = db_->getTech();
   loadConfig(cfg_filename, tech);
@@ -500,13 +750,18 @@ void DensityFill::fill(const char* cfg_filename, const odb::Rect& fill_area)
   dbChip* chip = db_->getChip();
   dbBlock* block = chip->getBlock();
 
+  // The debug graphics can't be drawn from the tile threads
+  if (graphics_) {
+    tile_size = 0;
+  }
+
   for (dbTechLayer* layer : tech->getLayers()) {
     auto it = layers_.find(layer);
     if (it == layers_.end()) {
       logger_->warn(FIN, 10, "Skipping layer {}.", layer->getConstName());
       continue;
     }
-    fillLayer(block, layer, fill_area);
+    fillLayer(block, layer, fill_area, tile_size, threads);
   }
 }
 
@@ -31,7 +31,12 @@ class DensityFill
   DensityFill(const DensityFill&&) = delete;
   DensityFill& operator=(const DensityFill&&) = delete;
 
-  void fill(const char* cfg_filename, const odb::Rect& fill_area);
+  // A tile_size above zero fills the area in tiles of that size using the
+  // given number of threads.
+  void fill(const char* cfg_filename,
+            const odb::Rect& fill_area,
+            int tile_size = 0,
+            int threads = 1);
 
  private:
   void loadConfig(const char* cfg_filename, odb::dbTech* tech);
@@ -39,7 +44,14 @@ class DensityFill
                            boost::property_tree::ptree& tree);
   void fillLayer(odb::dbBlock* block,
                  odb::dbTechLayer* layer,
-                 const odb::Rect& fill_bounds);
+                 const odb::Rect& fill_bounds,
+                 int tile_size,
+                 int threads);
+  void fillLayerTiles(odb::dbBlock* block,
+                      odb::dbTechLayer* layer,
+                      const odb::Rect& fill_bounds,
+                      int tile_size,
+                      int threads);
 
   odb::dbDatabase* db_;
   std::map<odb::dbTechLayer*, DensityFillLayerConfig> layers_;
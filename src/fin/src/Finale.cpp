@@ -20,10 +20,13 @@ void Finale::setDebug()
   debug_ = true;
 }
 
-void Finale::densityFill(const char* rules_filename, const odb::Rect& fill_area)
+void Finale::densityFill(const char* rules_filename,
+                         const odb::Rect& fill_area,
+                         const int tile_size,
+                         const int threads)
 {
   DensityFill filler(db_, logger_, debug_);
-  filler.fill(rules_filename, fill_area);
+  filler.fill(rules_filename, fill_area, tile_size, threads);
 }
 
 }  // namespace fin
@@ -6,11 +6,12 @@ proc density_fill_debug { args } {
 }
 
 sta::define_cmd_args "density_fill" {[-rules rules_file]\
-                                     [-area {lx ly ux uy}]}
+                                     [-area {lx ly ux uy}]\
+                                     [-tile_size tile_size]}
 
 proc density_fill { args } {
   sta::parse_key_args "density_fill" args \
-    keys {-rules -area} flags {}
+    keys {-rules -area -tile_size} flags {}
 
   if { [info exists keys(-rules)] } {
     set rules_file $keys(-rules)
@@ -33,5 +34,11 @@ proc density_fill { args } {
     set fill_area [ord::get_db_core]
   }
 
-  fin::density_fill_cmd $rules_file $fill_area
+  set tile_size 0
+  if { [info exists keys(-tile_size)] } {
+    sta::check_positive_float "-tile_size" $keys(-tile_size)
+    set tile_size [ord::microns_to_dbu $keys(-tile_size)]
+  }
+
+  fin::density_fill_cmd $rules_file $fill_area $tile_size
 }
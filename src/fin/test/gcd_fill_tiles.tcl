@@ -0,0 +1,49 @@
+# Tiled density fill
+source helpers.tcl
+
+read_lef sky130hd/sky130hd.tlef
+read_lef sky130hd/sky130_fd_sc_hd_merged.lef
+read_def gcd_prefill.def
+set_thread_count 2
+set block [ord::get_db_block]
+
+proc remove_fills { block } {
+  foreach fill [$block getFills] {
+    odb::dbFill_destroy $fill
+  }
+}
+
+# Fill the core at once for reference
+density_fill -rules fill.json
+set untiled_fills [llength [$block getFills]]
+remove_fills $block
+
+# A single tile covering the core sees the same fill area and non-fill
+# shapes as the untiled fill
+density_fill -rules fill.json -tile_size 1000
+set fills [llength [$block getFills]]
+if { $fills != $untiled_fills } {
+  puts "fail: $fills single tile fills vs $untiled_fills"
+  exit 1
+}
+remove_fills $block
+
+# Only the spacing kept at the edges between tiles changes the fill
+density_fill -rules fill.json -tile_size 20
+set fills [llength [$block getFills]]
+if { abs($fills - $untiled_fills) > 0.1 * $untiled_fills } {
+  puts "fail: $fills tiled fills vs $untiled_fills"
+  exit 1
+}
+remove_fills $block
+
+# Tiles too small for the fill spacing are enlarged rather than left empty
+density_fill -rules fill.json -tile_size 0.1
+set fills [llength [$block getFills]]
+if { $fills == 0 } {
+  puts "fail: no fills with small tiles"
+  exit 1
+}
+
+puts "pass"
+exit
@@ -108,6 +108,7 @@ class Replace
   void addTimingNetWeightOverflow(int overflow);
   void setTimingNetWeightMax(float max);
   void setKeepResizeBelowOverflow(float overflow);
+  void setTimingDrivenIncremental(bool mode);
 
   void setDebug(int pause_iterations,
                 int update_iterations,
@@ -173,6 +174,7 @@ class Replace
   float keepResizeBelowOverflow_ = 0.3;
 
   bool timingDrivenMode_ = true;
+  bool timingDrivenIncremental_ = false;
   bool routabilityDrivenMode_ = true;
   bool routabilityUseRudy_ = true;
   bool uniformTargetDensityMode_ = false;
@@ -184,6 +184,11 @@ void NesterovPlace::init()
             .Register(*registry);
   auto& hpwl_gauge = hpwl_gauge_family.Add({});
   hpwl_gauge_ = &hpwl_gauge;
+  overflow_gauge_ = &utl::BuildGauge()
+                         .Name("ord_gpl_overflow")
+                         .Help("The density overflow of global placement")
+                         .Register(*registry)
+                         .Add({});
 
   average_overflow_ = total_sum_overflow_ / nbVec_.size();
   baseWireLengthCoef_ = totalBaseWireLengthCoeff / nbVec_.size();
@@ -730,6 +735,7 @@ void NesterovPlace::updateNextIter(const int iter)
 
   average_overflow_ = total_sum_overflow_ / nbVec_.size();
   average_overflow_unscaled_ = total_sum_overflow_unscaled_ / nbVec_.size();
+  overflow_gauge_->Set(average_overflow_unscaled_);
 
   // For coefficient, using average regions' overflow
   updateWireLengthCoef(average_overflow_);
@@ -110,6 +110,7 @@ class NesterovPlace
 
   // observability metrics
   utl::Gauge<double>* hpwl_gauge_;
+  utl::Gauge<double>* overflow_gauge_;
 
   // half-parameter-wire-length
   int64_t prevHpwl_ = 0;
@@ -22,6 +22,7 @@
 #include "sta/StaMain.hh"
 #include "timingBase.h"
 #include "utl/Logger.h"
+#include "utl/tracer.h"
 
 namespace gpl {
 
@@ -86,6 +87,7 @@ void Replace::reset()
   routabilityMaxInflationIter_ = 4;
 
   timingDrivenMode_ = true;
+  timingDrivenIncremental_ = false;
   keepResizeBelowOverflow_ = 0.3;
   routabilityDrivenMode_ = true;
   routabilityUseRudy_ = true;
@@ -113,6 +115,7 @@ void Replace::addPlacementCluster(const Cluster& cluster)
 
 void Replace::doIncrementalPlace(int threads)
 {
+  utl::TraceZone zone("GPL:incremental", "gpl");
   if (pbc_ == nullptr) {
     PlacerBaseVars pbVars;
     pbVars.padLeft = padLeft_;
@@ -191,6 +194,7 @@ void Replace::doIncrementalPlace(int threads)
 
 void Replace::doInitialPlace(int threads)
 {
+  utl::TraceZone zone("GPL:initialPlace", "gpl");
   if (pbc_ == nullptr) {
     PlacerBaseVars pbVars;
     pbVars.padLeft = padLeft_;
@@ -312,6 +316,7 @@ bool Replace::initNesterovPlace(int threads)
     tb_ = std::make_shared<TimingBase>(nbc_, rs_, log_);
     tb_->setTimingNetWeightOverflows(timingNetWeightOverflows_);
     tb_->setTimingNetWeightMax(timingNetWeightMax_);
+    tb_->setIncremental(timingDrivenIncremental_);
   }
 
   if (!np_) {
@@ -352,6 +357,7 @@ bool Replace::initNesterovPlace(int threads)
 
 int Replace::doNesterovPlace(int threads, int start_iter)
 {
+  utl::TraceZone zone("GPL:nesterovPlace", "gpl");
   if (!initNesterovPlace(threads)) {
     return 0;
   }
@@ -518,6 +524,11 @@ void Replace::setKeepResizeBelowOverflow(float overflow)
   keepResizeBelowOverflow_ = overflow;
 }
 
+void Replace::setTimingDrivenIncremental(bool mode)
+{
+  timingDrivenIncremental_ = mode;
+}
+
 void Replace::setRoutabilityMaxDensity(float density)
 {
   routabilityMaxDensity_ = density;
@@ -175,6 +175,13 @@ set_keep_resize_below_overflow_cmd(float overflow)
   replace->setKeepResizeBelowOverflow(overflow);
 }
 
+void
+set_timing_driven_incremental_cmd(bool incremental)
+{
+  Replace* replace = getReplace();
+  replace->setTimingDrivenIncremental(incremental);
+}
+
 void
 set_routability_driven_mode(bool routability_driven)
 {
@@ -32,6 +32,7 @@ sta::define_cmd_args "global_placement" {\
     [-timing_driven_net_reweight_overflow timing_driven_net_reweight_overflow]\
     [-timing_driven_net_weight_max timing_driven_net_weight_max]\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
+    [-timing_driven_incremental]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
     [-disable_revert_if_diverge]\
@@ -58,6 +59,7 @@ proc global_placement { args } {
     flags {-skip_initial_place \
       -skip_nesterov_place \
       -timing_driven \
+      -timing_driven_incremental \
       -routability_driven \
       -routability_use_grt \
       -disable_timing_driven \
@@ -121,6 +123,9 @@ proc global_placement { args } {
     if { [info exists keys(-timing_driven_nets_percentage)] } {
       rsz::set_worst_slack_nets_percent $keys(-timing_driven_nets_percentage)
     }
+
+    gpl::set_timing_driven_incremental_cmd \
+      [info exists flags(-timing_driven_incremental)]
   }
 
   if { [info exists flags(-disable_timing_driven)] } {
@@ -6,11 +6,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdlib>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "nesterovBase.h"
+#include "odb/db.h"
 #include "placerBase.h"
 #include "rsz/Resizer.hh"
 #include "sta/Fuzzy.hh"
@@ -20,6 +22,10 @@ namespace gpl {
 
 using utl::GPL;
 
+// A net is re-estimated in incremental mode once its box moved by more than
+// this fraction of its half perimeter.
+static constexpr float kNetMoveRatio = 0.1;
+
 // TimingBase
 TimingBase::TimingBase() = default;
 
@@ -115,12 +121,60 @@ void TimingBase::setTimingNetWeightMax(float max)
   net_weight_max_ = max;
 }
 
-bool TimingBase::executeTimingDriven(bool run_journal_restore)
+std::vector<odb::dbNet*> TimingBase::findMovedNets()
 {
-  rs_->findResizeSlacks(run_journal_restore);
+  std::vector<odb::dbNet*> nets;
+  for (auto& gNet : nbc_->getGNets()) {
+    odb::dbNet* db_net = gNet->net()->dbNet();
+    const odb::Rect box(gNet->lx(), gNet->ly(), gNet->ux(), gNet->uy());
+    auto it = net_boxes_.find(db_net);
+    if (it != net_boxes_.end()) {
+      const odb::Rect& old_box = it->second;
+      const int move = std::max({std::abs(box.xMin() - old_box.xMin()),
+                                 std::abs(box.yMin() - old_box.yMin()),
+                                 std::abs(box.xMax() - old_box.xMax()),
+                                 std::abs(box.yMax() - old_box.yMax())});
+      if (move <= kNetMoveRatio * (old_box.dx() + old_box.dy())) {
+        continue;
+      }
+    }
+    net_boxes_[db_net] = box;
+    nets.push_back(db_net);
+  }
+  return nets;
+}
 
-  if (!run_journal_restore) {
-    nbc_->fixPointers();
+void TimingBase::saveNetBoxes()
+{
+  net_boxes_.clear();
+  for (auto& gNet : nbc_->getGNets()) {
+    net_boxes_[gNet->net()->dbNet()]
+        = odb::Rect(gNet->lx(), gNet->ly(), gNet->ux(), gNet->uy());
+  }
+}
+
+bool TimingBase::executeTimingDriven(bool run_journal_restore)
+{
+  // Non-virtual iterations keep the repair design changes so they always
+  // take the full path.
+  if (incremental_ && run_journal_restore && !net_boxes_.empty()) {
+    const std::vector<odb::dbNet*> nets = findMovedNets();
+    debugPrint(log_,
+               GPL,
+               "timing",
+               1,
+               "Timing-driven: re-estimating {} moved nets.",
+               nets.size());
+    rs_->findResizeSlacksIncremental(nets);
+  } else {
+    rs_->findResizeSlacks(run_journal_restore);
+
+    if (!run_journal_restore) {
+      nbc_->fixPointers();
+    }
+    if (incremental_) {
+      saveNetBoxes();
+    }
   }
 
   // get worst resize nets
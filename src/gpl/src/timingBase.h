@@ -5,10 +5,16 @@
 
 #include <cstddef>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
+#include "odb/geom.h"
 #include "rsz/Resizer.hh"
 
+namespace odb {
+class dbNet;
+}
+
 namespace rsz {
 class Resizer;
 }
@@ -39,6 +45,9 @@ class TimingBase
   size_t getTimingNetWeightOverflowSize() const;
 
   void setTimingNetWeightMax(float max);
+  // Virtual iterations only re-estimate the parasitics of moved nets and
+  // skip repair design.
+  void setIncremental(bool incremental) { incremental_ = incremental; }
 
   int repairDesignBufferCount() { return rs_->repairDesignBufferCount(); }
 
@@ -56,6 +65,13 @@ class TimingBase
   std::vector<int> timingOverflowChk_;
   float net_weight_max_ = 5;
   void initTimingOverflowChk();
+
+  std::vector<odb::dbNet*> findMovedNets();
+  void saveNetBoxes();
+
+  bool incremental_ = false;
+  // Net boxes the parasitics were last estimated with.
+  std::unordered_map<odb::dbNet*, odb::Rect> net_boxes_;
 };
 
 }  // namespace gpl
@@ -0,0 +1,29 @@
+# Incremental timing-driven placement must stay close to the full path
+source helpers.tcl
+set test_name simple01-td
+read_liberty ./library/nangate45/NangateOpenCellLibrary_typical.lib
+
+read_lef ./nangate45.lef
+read_def ./$test_name.def
+
+create_clock -name core_clock -period 2 clk
+
+set_wire_rc -signal -layer metal3
+set_wire_rc -clock  -layer metal5
+
+global_placement -timing_driven -timing_driven_incremental
+
+estimate_parasitics -placement
+set slack [sta::worst_slack -max]
+
+# Worst slack (ns) of the full path on the same design, from
+# simple01-td.ok, allowing 5% of the clock period.
+set full_slack 1.40
+set tolerance 0.1
+if { $slack < $full_slack - $tolerance } {
+  puts "fail: worst slack [format %.2f $slack] vs $full_slack"
+  exit 1
+}
+
+puts "pass"
+exit
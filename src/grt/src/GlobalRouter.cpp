@@ -49,6 +49,7 @@
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
+#include "utl/tracer.h"
 
 namespace grt {
 
@@ -146,6 +147,7 @@ GlobalRouter::~GlobalRouter()
 std::vector<Net*> GlobalRouter::initFastRoute(int min_routing_layer,
                                               int max_routing_layer)
 {
+  utl::TraceZone zone("GRT:init", "grt");
   fastroute_->clear();
   ensureLayerForGuideDimension(max_routing_layer);
 
@@ -263,6 +265,7 @@ void GlobalRouter::globalRoute(bool save_guides,
                                bool start_incremental,
                                bool end_incremental)
 {
+  utl::TraceZone zone("GRT:globalRoute", "grt");
   bool has_routable_nets = false;
   for (auto net : db_->getChip()->getBlock()->getNets()) {
     if (net->getITerms().size() + net->getBTerms().size() > 1) {
@@ -477,6 +480,7 @@ NetRouteMap GlobalRouter::findRouting(std::vector<Net*>& nets,
                                       int min_routing_layer,
                                       int max_routing_layer)
 {
+  utl::TraceZone zone("GRT:route", "grt");
   NetRouteMap routes;
   if (!nets.empty()) {
     MakeWireParasitics builder(
@@ -19,6 +19,7 @@
 #include "grt/GRoute.h"
 #include "odb/geom.h"
 #include "stt/SteinerTreeBuilder.h"
+#include "utl/prometheus/gauge.h"
 
 namespace utl {
 class Logger;
@@ -631,6 +632,7 @@ class FastRouteCore
   std::vector<StTree> sttrees_bk_;
 
   utl::Logger* logger_;
+  utl::Gauge<double>* overflow_gauge_;
   stt::SteinerTreeBuilder* stt_builder_;
   AbstractMakeWireParasitics* parasitics_builder_;
 
@@ -60,6 +60,11 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       debug_(new DebugSetting())
 {
   parasitics_builder_ = nullptr;
+  overflow_gauge_ = &utl::BuildGauge()
+                         .Name("ord_grt_overflow")
+                         .Help("Total overflow of the last routing iteration")
+                         .Register(*logger_->getRegistry())
+                         .Add({});
 }
 
 FastRouteCore::~FastRouteCore()
@@ -1060,6 +1065,7 @@ NetRouteMap FastRouteCore::run()
   int ripup_threshold = Ripvalue;
 
   minofl = total_overflow_;
+  overflow_gauge_->Set(total_overflow_);
   stopDEC = false;
 
   slope = 20;
@@ -1304,6 +1310,7 @@ NetRouteMap FastRouteCore::run()
     }
 
     last_total_overflow = total_overflow_;
+    overflow_gauge_->Set(total_overflow_);
 
     // generate DRC report each interval
     if (congestion_report_iter_step_ && i % congestion_report_iter_step_ == 0) {
@@ -186,6 +186,13 @@ void LayoutTabs::fullRepaint()
   }
 }
 
+void LayoutTabs::viewportRepaint()
+{
+  for (auto viewer : viewers_) {
+    viewer->viewportRepaint();
+  }
+}
+
 void LayoutTabs::startRulerBuild()
 {
   if (current_viewer_) {
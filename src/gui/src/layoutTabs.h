@@ -89,6 +89,9 @@ class LayoutTabs : public QTabWidget
   void blockLoaded(odb::dbBlock* block);
   void fit();
   void fullRepaint();
+  // Repaints the overlays (selection, highlights, rulers, labels) on top of
+  // the cached block tiles.
+  void viewportRepaint();
   void startRulerBuild();
   void cancelRulerBuild();
   void selection(const Selected& selection);
@@ -1305,7 +1305,7 @@ void LayoutViewer::updateScaleAndCentering(const QSize& new_size)
                  ((new_area.height() + bounds.dy() * pixels_per_dbu_) / 2
                   + bounds.yMin() * pixels_per_dbu_));
 
-    fullRepaint();
+    viewportRepaint();
   }
 }
 
@@ -1894,10 +1894,16 @@ void LayoutViewer::paintEvent(QPaintEvent* event)
 }
 
 void LayoutViewer::fullRepaint()
+{
+  viewer_thread_.clearTileCache();
+  viewportRepaint();
+}
+
+void LayoutViewer::viewportRepaint()
 {
   if (command_executing_ && !paused_) {
     QTimer::singleShot(
-        5 /*ms*/, this, &LayoutViewer::fullRepaint);  // retry later
+        5 /*ms*/, this, &LayoutViewer::viewportRepaint);  // retry later
     return;
   }
 
@@ -2016,7 +2022,7 @@ void LayoutViewer::setScroller(LayoutScroll* scroller)
   connect(scroller_,
           &LayoutScroll::centerChanged,
           this,
-          &LayoutViewer::fullRepaint);
+          &LayoutViewer::viewportRepaint);
 }
 
 void LayoutViewer::viewportUpdated()
@@ -2037,7 +2043,7 @@ void LayoutViewer::viewportUpdated()
   if (!zoomed_in) {
     resize(scroller_->maximumViewportSize());
   }
-  fullRepaint();
+  viewportRepaint();
 }
 
 QImage LayoutViewer::createImage(const Rect& region,
@@ -2466,11 +2472,25 @@ void LayoutViewer::commandAboutToExecute()
 {
   command_executing_ = true;
   paused_ = false;
+  // The command may modify the block the builders are reading
+  search_.deferBuilders(true);
+  try {
+    search_.waitForBuilders();
+  } catch (const std::exception& e) {
+    logger_->warn(utl::GUI,
+                  105,
+                  "An exception occurred building the index: {}",
+                  e.what());
+  } catch (...) {
+    logger_->warn(
+        utl::GUI, 106, "An unknown exception occurred building the index");
+  }
 }
 
 void LayoutViewer::commandFinishedExecuting()
 {
   command_executing_ = false;
+  search_.deferBuilders(false);
   update();
 }
 
@@ -226,6 +226,10 @@ class LayoutViewer : public QWidget
   // signals that the cache should be flushed and a full repaint should occur.
   void fullRepaint();
 
+  // repaint reusing the cached block tiles, e.g. after the visible area,
+  // the zoom or only the overlays (selection, highlights, rulers) changed.
+  void viewportRepaint();
+
   odb::Point getVisibleCenter();
 
   void selectHighlightConnectedInst(bool select_flag);
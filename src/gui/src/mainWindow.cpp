@@ -177,12 +177,19 @@ MainWindow::MainWindow(bool load_settings, QWidget* parent)
         addRuler(x0, y0, x1, y1, "", "", default_ruler_style_->isChecked());
       });
 
+  // These are drawn over the block, the cached block tiles stay valid.
+  connect(this,
+          &MainWindow::selectionChanged,
+          viewers_,
+          &LayoutTabs::viewportRepaint);
+  connect(this,
+          &MainWindow::highlightChanged,
+          viewers_,
+          &LayoutTabs::viewportRepaint);
   connect(
-      this, &MainWindow::selectionChanged, viewers_, &LayoutTabs::fullRepaint);
+      this, &MainWindow::rulersChanged, viewers_, &LayoutTabs::viewportRepaint);
   connect(
-      this, &MainWindow::highlightChanged, viewers_, &LayoutTabs::fullRepaint);
-  connect(this, &MainWindow::rulersChanged, viewers_, &LayoutTabs::fullRepaint);
-  connect(this, &MainWindow::labelsChanged, viewers_, &LayoutTabs::fullRepaint);
+      this, &MainWindow::labelsChanged, viewers_, &LayoutTabs::viewportRepaint);
 
   connect(controls_, &DisplayControls::selected, [=](const Selected& selected) {
     setSelected(selected);
@@ -207,7 +214,7 @@ MainWindow::MainWindow(bool load_settings, QWidget* parent)
   connect(inspector_,
           &Inspector::selectedItemChanged,
           viewers_,
-          &LayoutTabs::fullRepaint);
+          &LayoutTabs::viewportRepaint);
   connect(inspector_,
           &Inspector::selectedItemChanged,
           this,
@@ -3,16 +3,24 @@
 
 #include "renderThread.h"
 
+#include <QFontDatabase>
 #include <QPainterPath>
 #include <QPolygon>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "layoutViewer.h"
 #include "odb/dbShape.h"
 #include "odb/dbTransform.h"
+#include "ord/OpenRoad.hh"
 #include "painter.h"
+#include "utl/exception.h"
 #include "utl/timer.h"
 
 namespace gui {
@@ -53,6 +61,21 @@ void RenderThread::setLogger(utl::Logger* logger)
   logger_ = logger;
 }
 
+void RenderThread::clearTileCache()
+{
+  clear_tiles_ = true;
+}
+
+bool RenderThread::TileKey::operator<(const TileKey& other) const
+{
+  return std::tie(pixels_per_dbu, shift_x, shift_y, x, y)
+         < std::tie(other.pixels_per_dbu,
+                    other.shift_x,
+                    other.shift_y,
+                    other.x,
+                    other.y);
+}
+
 // Inspiration taken from the Qt mandelbrot example
 void RenderThread::render(const QRect& draw_rect,
                           const SelectionSet& selected,
@@ -91,6 +114,9 @@ void RenderThread::render(const QRect& draw_rect,
 
 void RenderThread::run()
 {
+  // Draw whatever is indexed so far rather than wait for the search
+  Search::Progressive progressive_search;
+
   forever
   {
     SelectionSet selected;
@@ -116,7 +142,8 @@ void RenderThread::run()
            rulers,
            labels,
            1.0,
-           Qt::transparent);
+           Qt::transparent,
+           true);
     } catch (const std::exception& e) {
       logger_->warn(
           GUI, 102, "An exception occurred during rendering: {}", e.what());
@@ -171,7 +198,8 @@ void RenderThread::draw(QImage& image,
                         const Rulers& rulers,
                         const Labels& labels,
                         qreal render_ratio,
-                        const QColor& background)
+                        const QColor& background,
+                        bool use_tile_cache)
 {
   if (image.isNull()) {
     return;
@@ -208,7 +236,11 @@ void RenderThread::draw(QImage& image,
     image.fill(background);
   }
 
-  drawBlock(&painter, viewer_->block_, dbu_bounds, 0);
+  if (use_tile_cache) {
+    drawBlockTiles(&painter, draw_bounds);
+  } else {
+    drawBlock(&painter, viewer_->block_, dbu_bounds, 0);
+  }
 
   // draw selected and over top level and fast painting events
   drawSelected(gui_painter, selected);
@@ -218,6 +250,95 @@ void RenderThread::draw(QImage& image,
   drawLabels(gui_painter, labels);
 }
 
+// Composes the block from cached tiles and only draws the missing ones.
+// Tiles are keyed by the zoom so they stay valid while panning and when
+// returning to an earlier zoom; any other change goes through
+// clearTileCache().
+void RenderThread::drawBlockTiles(QPainter* painter, const QRect& draw_bounds)
+{
+  if (clear_tiles_.exchange(false) || tiles_block_ != viewer_->block_) {
+    tiles_.clear();
+    tiles_block_ = viewer_->block_;
+  }
+
+  utl::Timer timer;
+  const qreal pixels_per_dbu = viewer_->pixels_per_dbu_;
+  const QPoint shift = viewer_->centering_shift_;
+  const auto tile_index = [](int pixel) {
+    return static_cast<int>(std::floor(pixel / double(kTileSize)));
+  };
+  // Objects just outside a tile are drawn too, so text that spills over
+  // its object is not cut at the tile edges.
+  const int margin = kTileSize / 8;
+
+  int drawn = 0;
+  int reused = 0;
+  painter->save();
+  painter->resetTransform();
+  painter->translate(-draw_bounds.topLeft());
+  for (int y = tile_index(draw_bounds.top());
+       y <= tile_index(draw_bounds.bottom()) && !restart_;
+       y++) {
+    for (int x = tile_index(draw_bounds.left());
+         x <= tile_index(draw_bounds.right()) && !restart_;
+         x++) {
+      const TileKey key{pixels_per_dbu, shift.x(), shift.y(), x, y};
+      const QRect tile_rect(x * kTileSize, y * kTileSize, kTileSize, kTileSize);
+      auto tile = tiles_.find(key);
+      if (tile != tiles_.end()) {
+        tile->second.last_used = ++tile_clock_;
+        painter->drawImage(tile_rect.topLeft(), tile->second.image);
+        reused++;
+        continue;
+      }
+
+      QImage image(kTileSize, kTileSize, QImage::Format_ARGB32_Premultiplied);
+      image.fill(Qt::transparent);
+      {
+        QPainter tile_painter(&image);
+        tile_painter.setRenderHints(QPainter::Antialiasing);
+        tile_painter.translate(-tile_rect.topLeft());
+        tile_painter.translate(shift);
+        tile_painter.scale(pixels_per_dbu, -pixels_per_dbu);
+        const QRect bounds
+            = tile_rect.adjusted(-margin, -margin, margin, margin);
+        drawBlock(
+            &tile_painter, viewer_->block_, viewer_->screenToDBU(bounds), 0);
+      }
+      if (restart_) {
+        // the tile may be incomplete
+        break;
+      }
+      painter->drawImage(tile_rect.topLeft(), image);
+      addTile(key, std::move(image));
+      drawn++;
+    }
+  }
+  painter->restore();
+
+  debugPrint(logger_,
+             GUI,
+             "draw",
+             1,
+             "tiles drawn {} reused {} ({})",
+             drawn,
+             reused,
+             timer);
+}
+
+void RenderThread::addTile(const TileKey& key, QImage image)
+{
+  if (tiles_.size() >= kMaxTiles) {
+    // Evict the least recently used tile
+    auto oldest = std::min_element(
+        tiles_.begin(), tiles_.end(), [](const auto& lhs, const auto& rhs) {
+          return lhs.second.last_used < rhs.second.last_used;
+        });
+    tiles_.erase(oldest);
+  }
+  tiles_[key] = Tile{std::move(image), ++tile_clock_};
+}
+
 QColor RenderThread::getColor(dbTechLayer* layer)
 {
   return viewer_->options_->color(layer);
@@ -910,14 +1031,151 @@ void RenderThread::drawLayer(QPainter* painter,
   if (!viewer_->options_->isVisible(layer)) {
     return;
   }
+  drawLayerShapes(painter, block, layer, insts, bounds, gui_painter);
+  drawLayerRenderers(layer, gui_painter);
+}
+
+// Draw the layers in order.  The layers' shapes are drawn on worker
+// threads, each into its own image, and the images are then composited in
+// layer order together with the renderers' layer graphics.  Renderers are
+// always drawn on this thread.
+void RenderThread::drawLayers(QPainter* painter,
+                              odb::dbBlock* block,
+                              const std::vector<dbTechLayer*>& layers,
+                              const std::vector<dbInst*>& insts,
+                              const Rect& bounds,
+                              GuiPainter& gui_painter)
+{
+  std::vector<dbTechLayer*> visible_layers;
+  for (dbTechLayer* layer : layers) {
+    if (viewer_->options_->isVisible(layer)) {
+      visible_layers.push_back(layer);
+    }
+  }
+
+  const QPaintDevice* device = painter->device();
+  const size_t image_bytes = 4UL * device->width() * device->height();
+  const size_t max_images = std::max(
+      size_t{1}, kMaxLayerImageBytes / std::max(image_bytes, size_t{1}));
+  const size_t threads
+      = std::min({static_cast<size_t>(
+                      ord::OpenRoad::openRoad()->getThreadCount()),
+                  max_images,
+                  visible_layers.size()});
+  // Child blocks draw their layers recursively, renderers included.
+  const bool parallel = threads > 1 && block->getChildren().empty()
+                        && QFontDatabase::supportsThreadedFontRendering();
+  if (!parallel) {
+    for (dbTechLayer* layer : visible_layers) {
+      if (restart_) {
+        break;
+      }
+      drawLayerShapes(painter, block, layer, insts, bounds, gui_painter);
+      drawLayerRenderers(layer, gui_painter);
+    }
+    return;
+  }
+
+  // Make sure the masters' shapes are cached before the workers use them
+  for (dbInst* inst : insts) {
+    viewer_->boxesByLayer(inst->getMaster(), nullptr);
+  }
+
+  // Layers are handed out in batches small enough for their images to fit
+  // in kMaxLayerImageBytes.
+  const size_t batch_size = std::min(max_images, visible_layers.size());
+  std::vector<QImage> images;
+  images.reserve(batch_size);
+  for (size_t i = 0; i < batch_size; i++) {
+    images.emplace_back(
+        device->width(), device->height(), QImage::Format_ARGB32_Premultiplied);
+  }
+
+  for (size_t begin = 0; begin < visible_layers.size() && !restart_;
+       begin += batch_size) {
+    const size_t end = std::min(begin + batch_size, visible_layers.size());
+    std::atomic<size_t> next_layer{begin};
+    utl::ThreadException exception;
+    const bool progressive_search = Search::isProgressive();
+    auto draw_layers = [&]() {
+      Search::Progressive progressive(progressive_search);
+      try {
+        for (size_t i = next_layer++; i < end && !restart_; i = next_layer++) {
+          QImage& image = images[i - begin];
+          image.fill(Qt::transparent);
+          QPainter layer_painter(&image);
+          layer_painter.setRenderHints(painter->renderHints());
+          layer_painter.setTransform(painter->transform());
+          layer_painter.setFont(painter->font());
+          GuiPainter layer_gui_painter(&layer_painter,
+                                       viewer_->options_,
+                                       bounds,
+                                       viewer_->pixels_per_dbu_,
+                                       block->getDbUnitsPerMicron());
+          drawLayerShapes(&layer_painter,
+                          block,
+                          visible_layers[i],
+                          insts,
+                          bounds,
+                          layer_gui_painter);
+        }
+      } catch (...) {
+        exception.capture();
+      }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(threads, end - begin); i++) {
+      workers.emplace_back(draw_layers);
+    }
+    draw_layers();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    exception.rethrow();
+
+    for (size_t i = begin; i < end && !restart_; i++) {
+      painter->save();
+      painter->resetTransform();
+      painter->drawImage(0, 0, images[i - begin]);
+      painter->restore();
+      drawLayerRenderers(visible_layers[i], gui_painter);
+    }
+  }
+}
+
+void RenderThread::drawLayerRenderers(dbTechLayer* layer,
+                                      GuiPainter& gui_painter)
+{
+  for (auto* renderer : Gui::get()->renderers()) {
+    if (restart_) {
+      break;
+    }
+    gui_painter.saveState();
+    renderer->drawLayer(layer, gui_painter);
+    gui_painter.restoreState();
+  }
+}
+
+// Draw the layer's shapes, this may be run on several threads at once
+// (see drawLayers) so it must only read the viewer's state.
+void RenderThread::drawLayerShapes(QPainter* painter,
+                                   odb::dbBlock* block,
+                                   dbTechLayer* layer,
+                                   const std::vector<dbInst*>& insts,
+                                   const Rect& bounds,
+                                   GuiPainter& gui_painter)
+{
   utl::Timer layer_timer;
 
   const int shape_limit = viewer_->shapeSizeLimit();
+  const auto cut_maximum_size = [this](dbTechLayer* cut_layer) {
+    auto it = viewer_->cut_maximum_size_.find(cut_layer);
+    return it != viewer_->cut_maximum_size_.end() ? it->second : 0;
+  };
 
   // Skip the cut layer if the cuts will be too small to see
-  const bool draw_shapes
-      = !(layer->getType() == dbTechLayerType::CUT
-          && viewer_->cut_maximum_size_[layer] < shape_limit);
+  const bool draw_shapes = !(layer->getType() == dbTechLayerType::CUT
+                             && cut_maximum_size(layer) < shape_limit);
   const bool layer_is_routing = layer->getType() == dbTechLayerType::CUT
                                 || layer->getType() == dbTechLayerType::ROUTING;
 
@@ -975,12 +1233,12 @@ void RenderThread::drawLayer(QPainter* painter,
         // will be too small based on the cut size (enclosure shapes
         // are generally only slightly larger).
         if (auto upper = layer->getUpperLayer()) {
-          if (viewer_->cut_maximum_size_[upper] >= shape_limit) {
+          if (cut_maximum_size(upper) >= shape_limit) {
             drawViaShapes(painter, block, upper, layer, bounds, shape_limit);
           }
         }
         if (auto lower = layer->getLowerLayer()) {
-          if (viewer_->cut_maximum_size_[lower] >= shape_limit) {
+          if (cut_maximum_size(lower) >= shape_limit) {
             drawViaShapes(painter, block, lower, layer, bounds, shape_limit);
           }
         }
@@ -1060,14 +1318,6 @@ void RenderThread::drawLayer(QPainter* painter,
     drawNetTracks(gui_painter, layer);
   }
 
-  for (auto* renderer : Gui::get()->renderers()) {
-    if (restart_) {
-      break;
-    }
-    gui_painter.saveState();
-    renderer->drawLayer(layer, gui_painter);
-    gui_painter.restoreState();
-  }
   debugPrint(logger_,
              GUI,
              "draw",
@@ -1160,21 +1410,16 @@ void RenderThread::drawBlock(QPainter* painter,
     }
   }
 
+  std::vector<dbTechLayer*> layers;
   for (dbTech* child_tech : child_techs) {
     for (dbTechLayer* layer : child_tech->getLayers()) {
-      if (restart_) {
-        break;
-      }
-      drawLayer(painter, block, layer, insts, bounds, gui_painter);
+      layers.push_back(layer);
     }
   }
-
   for (dbTechLayer* layer : tech->getLayers()) {
-    if (restart_) {
-      break;
-    }
-    drawLayer(painter, block, layer, insts, bounds, gui_painter);
+    layers.push_back(layer);
   }
+  drawLayers(painter, block, layers, insts, bounds, gui_painter);
 
   utl::Timer inst_names;
   drawInstanceNames(painter, insts);
@@ -1557,10 +1802,12 @@ void RenderThread::drawIOPins(Painter& painter,
                               const odb::Rect& bounds,
                               odb::dbTechLayer* layer)
 {
-  const auto& pins = pins_[layer];
-  if (pins.empty()) {
+  // Layers may be drawn concurrently so pins_ must not be modified here
+  const auto pins_it = pins_.find(layer);
+  if (pins_it == pins_.end()) {
     return;
   }
+  const auto& pins = pins_it->second;
 
   const auto die_area = block->getDieArea();
 
@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <QImage>
 #include <QMutex>
 #include <QPainter>
 #include <QThread>
 #include <QWaitCondition>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <mutex>
 #include <vector>
 
@@ -38,6 +43,10 @@ class RenderThread : public QThread
 
   void exit();
 
+  // Drops the cached tiles so the next render redraws the block.  Safe to
+  // call while a render is in progress.
+  void clearTileCache();
+
   // Only to be used by save_image for synchronous rendering
   void draw(QImage& image,
             const QRect& draw_bounds,
@@ -46,7 +55,8 @@ class RenderThread : public QThread
             const Rulers& rulers,
             const Labels& labels,
             qreal render_ratio,
-            const QColor& background);
+            const QColor& background,
+            bool use_tile_cache = false);
 
   bool isFirstRenderDone() { return is_first_render_done_; };
   bool isRendering() { return is_rendering_; };
@@ -55,8 +65,29 @@ class RenderThread : public QThread
   void done(const QImage& image, const QRect& bounds);
 
  private:
+  // The block is rendered in square tiles of the viewer's pixel space,
+  // identified by the zoom they were drawn at and their position.
+  struct TileKey
+  {
+    qreal pixels_per_dbu;
+    int shift_x;
+    int shift_y;
+    int x;
+    int y;
+
+    bool operator<(const TileKey& other) const;
+  };
+  struct Tile
+  {
+    QImage image;
+    uint64_t last_used;
+  };
+
   void run() override;
 
+  void drawBlockTiles(QPainter* painter, const QRect& draw_bounds);
+  void addTile(const TileKey& key, QImage image);
+
   void setupIOPins(odb::dbBlock* block, const odb::Rect& bounds);
 
   void drawBlock(QPainter* painter,
@@ -69,6 +100,19 @@ class RenderThread : public QThread
                  const std::vector<odb::dbInst*>& insts,
                  const odb::Rect& bounds,
                  GuiPainter& gui_painter);
+  void drawLayers(QPainter* painter,
+                  odb::dbBlock* block,
+                  const std::vector<odb::dbTechLayer*>& layers,
+                  const std::vector<odb::dbInst*>& insts,
+                  const odb::Rect& bounds,
+                  GuiPainter& gui_painter);
+  void drawLayerShapes(QPainter* painter,
+                       odb::dbBlock* block,
+                       odb::dbTechLayer* layer,
+                       const std::vector<odb::dbInst*>& insts,
+                       const odb::Rect& bounds,
+                       GuiPainter& gui_painter);
+  void drawLayerRenderers(odb::dbTechLayer* layer, GuiPainter& gui_painter);
   void drawRegions(QPainter* painter, odb::dbBlock* block);
   void drawTracks(odb::dbTechLayer* layer,
                   QPainter* painter,
@@ -154,6 +198,17 @@ class RenderThread : public QThread
   bool is_rendering_ = false;
   bool is_first_render_done_ = false;
 
+  // Only accessed from the render thread, except clear_tiles_.  A tile is
+  // 512x512 ARGB, i.e. 1MB, so a full cache takes 128MB per viewer.
+  static constexpr int kTileSize = 512;
+  static constexpr int kMaxTiles = 128;
+  // Memory available to the per layer images of drawLayers
+  static constexpr size_t kMaxLayerImageBytes = 256UL << 20;
+  std::map<TileKey, Tile> tiles_;
+  odb::dbBlock* tiles_block_ = nullptr;
+  uint64_t tile_clock_ = 0;
+  std::atomic_bool clear_tiles_{false};
+
   QFont pin_font_;
   bool pin_draw_names_ = false;
   double pin_max_size_ = 0.0;
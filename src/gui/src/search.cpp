@@ -3,16 +3,34 @@
 
 #include "search.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "odb/dbShape.h"
+#include "ord/OpenRoad.hh"
+#include "utl/exception.h"
 
 namespace gui {
 
+thread_local bool Search::progressive_ = false;
+
 Search::~Search()
 {
+  try {
+    waitForBuilders();
+  } catch (...) {
+    // Nothing is left to use the indexes
+  }
   if (top_block_ != nullptr) {
     removeOwner();  // unregister as a callback object
   }
@@ -150,6 +168,7 @@ void Search::inDbWirePostModify(odb::dbWire* wire)
 void Search::setTopBlock(odb::dbBlock* block)
 {
   if (top_block_ != block) {
+    waitForBuilders();
     clear();
 
     if (top_block_ != nullptr) {
@@ -174,6 +193,8 @@ void Search::setTopBlock(odb::dbBlock* block)
 
 void Search::announceModified(std::atomic_bool& flag)
 {
+  // Builders in flight have read the block before this change
+  generation_++;
   const bool prev_flag = flag.exchange(false);
 
   if (prev_flag) {
@@ -227,6 +248,132 @@ Search::BlockData& Search::getData(odb::dbBlock* block)
   return block == top_block_ ? top_block_data_ : child_block_data_[block];
 }
 
+bool Search::ensureIndex(odb::dbBlock* block,
+                         const std::atomic_bool& init,
+                         std::atomic_bool& building,
+                         void (Search::*update)(odb::dbBlock*))
+{
+  if (init) {
+    return true;
+  }
+  if (!progressive_) {
+    (this->*update)(block);
+    return true;
+  }
+
+  std::vector<std::future<void>> done;
+  {
+    std::lock_guard<std::mutex> lock(builders_mutex_);
+    if (builders_deferred_) {
+      // The block may be being modified; build once the command is done
+      builds_skipped_ = true;
+      return false;
+    }
+    if (building.exchange(true)) {
+      return false;
+    }
+    // Take out the builders that are done
+    auto running = std::partition(
+        builders_.begin(),
+        builders_.end(),
+        [](const std::future<void>& builder) {
+          return builder.wait_for(std::chrono::seconds(0))
+                 != std::future_status::ready;
+        });
+    std::move(running, builders_.end(), std::back_inserter(done));
+    builders_.erase(running, builders_.end());
+    builders_.push_back(
+        std::async(std::launch::async, [this, block, &building, update]() {
+          try {
+            (this->*update)(block);
+          } catch (...) {
+            building = false;
+            throw;
+          }
+          building = false;
+          emit modified();
+        }));
+  }
+  // Report the failures of the builders that are done
+  for (auto& builder : done) {
+    builder.get();
+  }
+  return false;
+}
+
+void Search::deferBuilders(bool defer)
+{
+  bool resume_skipped = false;
+  {
+    std::lock_guard<std::mutex> lock(builders_mutex_);
+    builders_deferred_ = defer;
+    if (!defer) {
+      resume_skipped = builds_skipped_;
+      builds_skipped_ = false;
+    }
+  }
+  if (resume_skipped) {
+    // Redraw so the skipped indexes are requested again
+    emit modified();
+  }
+}
+
+void Search::waitForBuilders()
+{
+  std::vector<std::future<void>> builders;
+  {
+    std::lock_guard<std::mutex> lock(builders_mutex_);
+    builders.swap(builders_);
+  }
+  // Join all of them before reporting a failure
+  utl::ThreadException exception;
+  for (auto& builder : builders) {
+    try {
+      builder.get();
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+}
+
+// Bulk load the tree of every layer from its values, the layers in parallel.
+template <typename Tree, typename Value>
+void Search::bulkLoad(LayerMap<Tree>& trees,
+                      const LayerMap<std::vector<Value>>& values)
+{
+  std::vector<std::pair<Tree*, const std::vector<Value>*>> layers;
+  for (const auto& [layer, layer_values] : values) {
+    layers.emplace_back(&trees[layer], &layer_values);
+  }
+
+  std::atomic<size_t> next_layer{0};
+  utl::ThreadException exception;
+  auto load = [&]() {
+    try {
+      for (size_t i = next_layer++; i < layers.size(); i = next_layer++) {
+        const auto& [tree, layer_values] = layers[i];
+        *tree = Tree(layer_values->begin(), layer_values->end());
+      }
+    } catch (...) {
+      exception.capture();
+    }
+  };
+
+  const size_t threads = std::min(
+      layers.size(),
+      static_cast<size_t>(ord::OpenRoad::openRoad()->getThreadCount()));
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < threads; i++) {
+    workers.emplace_back(load);
+  }
+  load();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  exception.rethrow();
+}
+
 void Search::updateShapes(odb::dbBlock* block)
 {
   BlockData& data = getData(block);
@@ -234,6 +381,8 @@ void Search::updateShapes(odb::dbBlock* block)
   if (data.shapes_init_) {
     return;  // already done by another thread
   }
+  // The index is stale if the block changes before it is done
+  const uint64_t generation = generation_;
 
   data.box_shapes_.clear();
   data.snet_via_shapes_.clear();
@@ -244,15 +393,9 @@ void Search::updateShapes(odb::dbBlock* block)
   for (odb::dbNet* net : block->getNets()) {
     addSNet(net, snet_shapes, snet_net_via_shapes);
   }
-  for (const auto& [layer, layer_shapes] : snet_shapes) {
-    data.snet_shapes_[layer] = RtreeSNetShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
+  bulkLoad(data.snet_shapes_, snet_shapes);
   snet_shapes.clear();
-  for (const auto& [layer, layer_shapes] : snet_net_via_shapes) {
-    data.snet_via_shapes_[layer] = RtreeSNetDBoxShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
+  bulkLoad(data.snet_via_shapes_, snet_net_via_shapes);
   snet_net_via_shapes.clear();
 
   LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>> net_shapes;
@@ -276,12 +419,9 @@ void Search::updateShapes(odb::dbBlock* block)
       }
     }
   }
-  for (const auto& [layer, layer_shapes] : net_shapes) {
-    data.box_shapes_[layer] = RtreeRoutingShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
+  bulkLoad(data.box_shapes_, net_shapes);
 
-  data.shapes_init_ = true;
+  data.shapes_init_ = generation == generation_;
 }
 
 void Search::updateFills(odb::dbBlock* block)
@@ -291,6 +431,7 @@ void Search::updateFills(odb::dbBlock* block)
   if (data.fills_init_) {
     return;  // already done by another thread
   }
+  const uint64_t generation = generation_;
 
   data.fills_.clear();
 
@@ -298,11 +439,9 @@ void Search::updateFills(odb::dbBlock* block)
   for (odb::dbFill* fill : block->getFills()) {
     fills[fill->getTechLayer()].push_back(fill);
   }
-  for (const auto& [layer, layer_fill] : fills) {
-    data.fills_[layer] = RtreeFill(layer_fill.begin(), layer_fill.end());
-  }
+  bulkLoad(data.fills_, fills);
 
-  data.fills_init_ = true;
+  data.fills_init_ = generation == generation_;
 }
 
 void Search::updateInsts(odb::dbBlock* block)
@@ -312,6 +451,7 @@ void Search::updateInsts(odb::dbBlock* block)
   if (data.insts_init_) {
     return;  // already done by another thread
   }
+  const uint64_t generation = generation_;
 
   data.insts_.clear();
 
@@ -323,7 +463,7 @@ void Search::updateInsts(odb::dbBlock* block)
   }
   data.insts_ = RtreeDBox<odb::dbInst*>(insts.begin(), insts.end());
 
-  data.insts_init_ = true;
+  data.insts_init_ = generation == generation_;
 }
 
 void Search::updateBlockages(odb::dbBlock* block)
@@ -333,6 +473,7 @@ void Search::updateBlockages(odb::dbBlock* block)
   if (data.blockages_init_) {
     return;  // already done by another thread
   }
+  const uint64_t generation = generation_;
 
   data.blockages_.clear();
 
@@ -346,7 +487,7 @@ void Search::updateBlockages(odb::dbBlock* block)
   data.blockages_
       = RtreeDBox<odb::dbBlockage*>(blockages.begin(), blockages.end());
 
-  data.blockages_init_ = true;
+  data.blockages_init_ = generation == generation_;
 }
 
 void Search::updateObstructions(odb::dbBlock* block)
@@ -356,6 +497,7 @@ void Search::updateObstructions(odb::dbBlock* block)
   if (data.obstructions_init_) {
     return;  // already done by another thread
   }
+  const uint64_t generation = generation_;
 
   data.obstructions_.clear();
 
@@ -367,12 +509,9 @@ void Search::updateObstructions(odb::dbBlock* block)
     odb::dbBox* bbox = obs->getBBox();
     obstructions[bbox->getTechLayer()].push_back(obs);
   }
-  for (const auto& [layer, layer_obs] : obstructions) {
-    data.obstructions_[layer]
-        = RtreeDBox<odb::dbObstruction*>(layer_obs.begin(), layer_obs.end());
-  }
+  bulkLoad(data.obstructions_, obstructions);
 
-  data.obstructions_init_ = true;
+  data.obstructions_init_ = generation == generation_;
 }
 
 void Search::updateRows(odb::dbBlock* block)
@@ -382,6 +521,7 @@ void Search::updateRows(odb::dbBlock* block)
   if (data.rows_init_) {
     return;  // already done by another thread
   }
+  const uint64_t generation = generation_;
 
   data.rows_.clear();
 
@@ -391,7 +531,7 @@ void Search::updateRows(odb::dbBlock* block)
   }
   data.rows_ = RtreeRect<odb::dbRow*>(rows.begin(), rows.end());
 
-  data.rows_init_ = true;
+  data.rows_init_ = generation == generation_;
 }
 
 void Search::addVia(
@@ -578,8 +718,11 @@ Search::RoutingRange Search::searchBoxShapes(odb::dbBlock* block,
                                              int min_size)
 {
   BlockData& data = getData(block);
-  if (!data.shapes_init_) {
-    updateShapes(block);
+  if (!ensureIndex(block,
+                   data.shapes_init_,
+                   data.shapes_building_,
+                   &Search::updateShapes)) {
+    return RoutingRange();
   }
 
   auto it = data.box_shapes_.find(layer);
@@ -610,8 +753,11 @@ Search::SNetSBoxRange Search::searchSNetViaShapes(odb::dbBlock* block,
                                                   int min_size)
 {
   BlockData& data = getData(block);
-  if (!data.shapes_init_) {
-    updateShapes(block);
+  if (!ensureIndex(block,
+                   data.shapes_init_,
+                   data.shapes_building_,
+                   &Search::updateShapes)) {
+    return SNetSBoxRange();
   }
 
   auto it = data.snet_via_shapes_.find(layer);
@@ -642,8 +788,11 @@ Search::SNetShapeRange Search::searchSNetShapes(odb::dbBlock* block,
                                                 int min_size)
 {
   BlockData& data = getData(block);
-  if (!data.shapes_init_) {
-    updateShapes(block);
+  if (!ensureIndex(block,
+                   data.shapes_init_,
+                   data.shapes_building_,
+                   &Search::updateShapes)) {
+    return SNetShapeRange();
   }
 
   auto it = data.snet_shapes_.find(layer);
@@ -679,8 +828,11 @@ Search::FillRange Search::searchFills(odb::dbBlock* block,
                                       int min_size)
 {
   BlockData& data = getData(block);
-  if (!data.fills_init_) {
-    updateFills(block);
+  if (!ensureIndex(block,
+                   data.fills_init_,
+                   data.fills_building_,
+                   &Search::updateFills)) {
+    return FillRange();
   }
 
   auto it = data.fills_.find(layer);
@@ -709,8 +861,11 @@ Search::InstRange Search::searchInsts(odb::dbBlock* block,
                                       int min_height)
 {
   BlockData& data = getData(block);
-  if (!data.insts_init_) {
-    updateInsts(block);
+  if (!ensureIndex(block,
+                   data.insts_init_,
+                   data.insts_building_,
+                   &Search::updateInsts)) {
+    return InstRange();
   }
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
@@ -734,8 +889,11 @@ Search::BlockageRange Search::searchBlockages(odb::dbBlock* block,
                                               int min_height)
 {
   BlockData& data = getData(block);
-  if (!data.blockages_init_) {
-    updateBlockages(block);
+  if (!ensureIndex(block,
+                   data.blockages_init_,
+                   data.blockages_building_,
+                   &Search::updateBlockages)) {
+    return BlockageRange();
   }
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
@@ -761,8 +919,11 @@ Search::ObstructionRange Search::searchObstructions(odb::dbBlock* block,
                                                     int min_size)
 {
   BlockData& data = getData(block);
-  if (!data.obstructions_init_) {
-    updateObstructions(block);
+  if (!ensureIndex(block,
+                   data.obstructions_init_,
+                   data.obstructions_building_,
+                   &Search::updateObstructions)) {
+    return ObstructionRange();
   }
 
   auto it = data.obstructions_.find(layer);
@@ -791,8 +952,11 @@ Search::RowRange Search::searchRows(odb::dbBlock* block,
                                     int min_height)
 {
   BlockData& data = getData(block);
-  if (!data.rows_init_) {
-    updateRows(block);
+  if (!ensureIndex(block,
+                   data.rows_init_,
+                   data.rows_building_,
+                   &Search::updateRows)) {
+    return RowRange();
   }
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
@@ -4,8 +4,12 @@
 #pragma once
 
 #include <QObject>
+#include <atomic>
 #include <boost/geometry.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <cstdint>
+#include <future>
+#include <map>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -121,11 +125,40 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   using BlockageRange = Range<RtreeDBox<odb::dbBlockage*>>;
   using RowRange = Range<RtreeRect<odb::dbRow*>>;
 
+  // While one exists on a thread, searches made from that thread don't wait
+  // for an index that isn't built yet.  The index is built in the
+  // background instead, the search returns no results and modified() is
+  // emitted once the index is ready.  This lets the layout be drawn
+  // progressively while a large design is being indexed.
+  class Progressive
+  {
+   public:
+    Progressive(bool enable = true) : previous_(progressive_)
+    {
+      progressive_ = enable;
+    }
+    ~Progressive() { progressive_ = previous_; }
+
+   private:
+    bool previous_;
+  };
+
   ~Search() override;
 
+  static bool isProgressive() { return progressive_; }
+
   // Build the structure for the given block.
   void setTopBlock(odb::dbBlock* block);
 
+  // Wait for the indexes being built in the background, rethrowing the
+  // first failure.  Call before the block is modified.
+  void waitForBuilders();
+
+  // While deferred, progressive searches don't start new builders.  Set
+  // before the block is modified and clear once it is done; clearing
+  // emits modified() if any build was skipped in between.
+  void deferBuilders(bool defer);
+
   // Find all box shapes in the given bounds on the given layer which
   // are at least min_size in either dimension.
   RoutingRange searchBoxShapes(odb::dbBlock* block,
@@ -260,6 +293,18 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void updateObstructions(odb::dbBlock* block);
   void updateRows(odb::dbBlock* block);
 
+  // Returns true if the index is built, building it first unless the
+  // search is progressive, in which case it is built in the background
+  // once builders aren't deferred.
+  bool ensureIndex(odb::dbBlock* block,
+                   const std::atomic_bool& init,
+                   std::atomic_bool& building,
+                   void (Search::*update)(odb::dbBlock*));
+
+  template <typename Tree, typename Value>
+  static void bulkLoad(LayerMap<Tree>& trees,
+                       const LayerMap<std::vector<Value>>& values);
+
   void clear();
 
   void announceModified(std::atomic_bool& flag);
@@ -296,9 +341,27 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     std::atomic_bool blockages_init_{false};
     std::atomic_bool obstructions_init_{false};
     std::atomic_bool rows_init_{false};
+
+    // Set while the index is being built in the background
+    std::atomic_bool shapes_building_{false};
+    std::atomic_bool fills_building_{false};
+    std::atomic_bool insts_building_{false};
+    std::atomic_bool blockages_building_{false};
+    std::atomic_bool obstructions_building_{false};
+    std::atomic_bool rows_building_{false};
   };
   std::map<odb::dbBlock*, BlockData> child_block_data_;
   BlockData top_block_data_;
+
+  std::mutex builders_mutex_;
+  std::vector<std::future<void>> builders_;
+  // Guarded by builders_mutex_
+  bool builders_deferred_ = false;
+  bool builds_skipped_ = false;
+  // Bumped on every change to the block
+  std::atomic<uint64_t> generation_{0};
+
+  static thread_local bool progressive_;
 };
 
 }  // namespace gui
@@ -111,8 +111,6 @@ void SACoreHardMacro::perturb()
   }
 
   // Keep back up
-  pre_pos_seq_ = pos_seq_;
-  pre_neg_seq_ = neg_seq_;
   pre_width_ = width_;
   pre_height_ = height_;
   pre_outline_penalty_ = outline_penalty_;
@@ -162,15 +160,10 @@ void SACoreHardMacro::restore()
   // we need to call PackFloorplan again at the end of SA process
   if (action_id_ == 5) {
     macros_ = pre_macros_;
-    // macros_[macro_id_] = pre_macros_[macro_id_];
-  } else if (action_id_ == 1) {
-    pos_seq_ = pre_pos_seq_;
-  } else if (action_id_ == 2) {
-    neg_seq_ = pre_neg_seq_;
   } else {
-    pos_seq_ = pre_pos_seq_;
-    neg_seq_ = pre_neg_seq_;
+    undoSequencePairSwaps();
   }
+  undoWirelengthUpdate();
 
   width_ = pre_width_;
   height_ = pre_height_;
@@ -175,8 +175,6 @@ void SACoreSoftMacro::perturb()
   }
 
   // Keep back up
-  pre_pos_seq_ = pos_seq_;
-  pre_neg_seq_ = neg_seq_;
   pre_width_ = width_;
   pre_height_ = height_;
   pre_outline_penalty_ = outline_penalty_;
@@ -229,14 +227,10 @@ void SACoreSoftMacro::restore()
   // we need to call PackFloorplan again at the end of SA process
   if (action_id_ == 5) {
     macros_[macro_id_] = pre_macros_[macro_id_];
-  } else if (action_id_ == 1) {
-    pos_seq_ = pre_pos_seq_;
-  } else if (action_id_ == 2) {
-    neg_seq_ = pre_neg_seq_;
   } else {
-    pos_seq_ = pre_pos_seq_;
-    neg_seq_ = pre_neg_seq_;
+    undoSequencePairSwaps();
   }
+  undoWirelengthUpdate();
 
   width_ = pre_width_;
   height_ = pre_height_;
@@ -1045,6 +1039,7 @@ void SACoreSoftMacro::attemptCentralization(const float pre_cost)
     for (int& id : pos_seq_) {
       macros_[id].setX(clusters_locations[id].first);
       macros_[id].setY(clusters_locations[id].second);
+      checkMacroMoved(id);
     }
 
     if (graphics_) {
@@ -1060,6 +1055,7 @@ void SACoreSoftMacro::moveFloorplan(const std::pair<float, float>& offset)
   for (auto& id : pos_seq_) {
     macros_[id].setX(macros_[id].getX() + offset.first);
     macros_[id].setY(macros_[id].getY() + offset.second);
+    checkMacroMoved(id);
   }
 
   if (graphics_) {
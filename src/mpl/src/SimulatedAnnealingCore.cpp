@@ -108,8 +108,6 @@ void SimulatedAnnealingCore<T>::initSequencePair()
   while (macro_id < sequence_pair_size) {
     pos_seq_.push_back(macro_id);
     neg_seq_.push_back(macro_id);
-    pre_pos_seq_.push_back(macro_id);
-    pre_neg_seq_.push_back(macro_id);
 
     ++macro_id;
   }
@@ -120,18 +118,34 @@ template <class T>
 void SimulatedAnnealingCore<T>::setNets(const std::vector<BundledNet>& nets)
 {
   nets_ = nets;
+
+  tot_net_weight_ = 0.0;
+  macro_to_nets_.assign(macros_.size(), {});
+  for (int net_id = 0; net_id < nets_.size(); net_id++) {
+    const BundledNet& net = nets_[net_id];
+    tot_net_weight_ += net.weight;
+    macro_to_nets_[net.terminals.first].push_back(net_id);
+    if (net.terminals.second != net.terminals.first) {
+      macro_to_nets_[net.terminals.second].push_back(net_id);
+    }
+  }
+
+  // Force a full evaluation on the next call to calWirelength.
+  evaluated_pin_locations_.clear();
 }
 
 template <class T>
 void SimulatedAnnealingCore<T>::setFences(const std::map<int, Rect>& fences)
 {
   fences_ = fences;
+  evaluated_fence_boxes_.clear();
 }
 
 template <class T>
 void SimulatedAnnealingCore<T>::setGuides(const std::map<int, Rect>& guides)
 {
   guides_ = guides;
+  evaluated_guide_boxes_.clear();
 }
 
 template <class T>
@@ -265,38 +279,62 @@ void SimulatedAnnealingCore<T>::calWirelength()
 {
   // Initialization
   wirelength_ = 0.0;
-  if (core_weights_.wirelength <= 0.0) {
+  if (core_weights_.wirelength <= 0.0 || tot_net_weight_ <= 0.0) {
+    moved_macros_.clear();
     return;
   }
 
-  // calculate the total net weight
-  float tot_net_weight = 0.0;
-  for (const auto& net : nets_) {
-    tot_net_weight += net.weight;
-  }
+  net_wirelength_undo_.clear();
+  pin_location_undo_.clear();
+  pre_net_wirelength_sum_ = net_wirelength_sum_;
 
-  if (tot_net_weight <= 0.0) {
-    return;
-  }
-
-  for (const auto& net : nets_) {
-    T& source = macros_[net.terminals.first];
-    T& target = macros_[net.terminals.second];
-
-    if (target.isClusterOfUnplacedIOPins()) {
-      addBoundaryDistToWirelength(source, target, net.weight);
-      continue;
+  if (evaluated_pin_locations_.size() != macros_.size()) {
+    evaluated_pin_locations_.resize(macros_.size());
+    for (int macro_id = 0; macro_id < macros_.size(); macro_id++) {
+      evaluated_pin_locations_[macro_id] = {macros_[macro_id].getPinX(),
+                                            macros_[macro_id].getPinY()};
     }
-
-    const float x1 = source.getPinX();
-    const float y1 = source.getPinY();
-    const float x2 = target.getPinX();
-    const float y2 = target.getPinY();
-    wirelength_ += net.weight * (std::abs(x2 - x1) + std::abs(y2 - y1));
+    net_wirelengths_.resize(nets_.size());
+    net_wirelength_sum_ = 0.0;
+    for (int net_id = 0; net_id < nets_.size(); net_id++) {
+      net_wirelengths_[net_id] = calNetWirelength(nets_[net_id]);
+      net_wirelength_sum_ += net_wirelengths_[net_id];
+    }
+    net_visit_stamps_.assign(nets_.size(), 0);
+    visit_stamp_ = 0;
+    undo_full_evaluation_ = true;
+  } else {
+    // Only the nets connected to a macro whose pin moved since the
+    // previous evaluation need to be recomputed.
+    visit_stamp_++;
+    for (const int macro_id : moved_macros_) {
+      const T& macro = macros_[macro_id];
+      const std::pair<float, float> pin_location(macro.getPinX(),
+                                                 macro.getPinY());
+      if (evaluated_pin_locations_[macro_id] == pin_location) {
+        continue;
+      }
+      pin_location_undo_.emplace_back(macro_id,
+                                      evaluated_pin_locations_[macro_id]);
+      evaluated_pin_locations_[macro_id] = pin_location;
+
+      for (const int net_id : macro_to_nets_[macro_id]) {
+        if (net_visit_stamps_[net_id] == visit_stamp_) {
+          continue;
+        }
+        net_visit_stamps_[net_id] = visit_stamp_;
+        const float net_wirelength = calNetWirelength(nets_[net_id]);
+        net_wirelength_undo_.emplace_back(net_id, net_wirelengths_[net_id]);
+        net_wirelength_sum_ += net_wirelength - net_wirelengths_[net_id];
+        net_wirelengths_[net_id] = net_wirelength;
+      }
+    }
+    undo_full_evaluation_ = false;
   }
+  moved_macros_.clear();
 
   // normalization
-  wirelength_ = wirelength_ / tot_net_weight
+  wirelength_ = net_wirelength_sum_ / tot_net_weight_
                 / (outline_.getHeight() + outline_.getWidth());
 
   if (graphics_) {
@@ -307,18 +345,74 @@ void SimulatedAnnealingCore<T>::calWirelength()
   }
 }
 
+// Queues macro_id for the next wirelength evaluation if its pin is
+// not where it was last evaluated.
 template <class T>
-void SimulatedAnnealingCore<T>::addBoundaryDistToWirelength(
+void SimulatedAnnealingCore<T>::checkMacroMoved(const int macro_id)
+{
+  if (macro_id >= evaluated_pin_locations_.size()) {
+    return;
+  }
+  const T& macro = macros_[macro_id];
+  const std::pair<float, float> pin_location(macro.getPinX(),
+                                             macro.getPinY());
+  if (evaluated_pin_locations_[macro_id] != pin_location) {
+    moved_macros_.push_back(macro_id);
+  }
+}
+
+// Reverts the net terms and the running total to their values before
+// the last calWirelength.
+template <class T>
+void SimulatedAnnealingCore<T>::undoWirelengthUpdate()
+{
+  if (undo_full_evaluation_) {
+    evaluated_pin_locations_.clear();
+    undo_full_evaluation_ = false;
+    return;
+  }
+  for (auto it = net_wirelength_undo_.rbegin();
+       it != net_wirelength_undo_.rend();
+       ++it) {
+    net_wirelengths_[it->first] = it->second;
+  }
+  for (auto it = pin_location_undo_.rbegin(); it != pin_location_undo_.rend();
+       ++it) {
+    evaluated_pin_locations_[it->first] = it->second;
+  }
+  net_wirelength_sum_ = pre_net_wirelength_sum_;
+  net_wirelength_undo_.clear();
+  pin_location_undo_.clear();
+}
+
+template <class T>
+float SimulatedAnnealingCore<T>::calNetWirelength(const BundledNet& net) const
+{
+  const T& source = macros_[net.terminals.first];
+  const T& target = macros_[net.terminals.second];
+
+  if (target.isClusterOfUnplacedIOPins()) {
+    return calBoundaryDistWirelength(source, target, net.weight);
+  }
+
+  const float x1 = source.getPinX();
+  const float y1 = source.getPinY();
+  const float x2 = target.getPinX();
+  const float y2 = target.getPinY();
+  return net.weight * (std::abs(x2 - x1) + std::abs(y2 - y1));
+}
+
+template <class T>
+float SimulatedAnnealingCore<T>::calBoundaryDistWirelength(
     const T& macro,
     const T& unplaced_ios,
-    const float net_weight)
+    const float net_weight) const
 {
   // To generate maximum cost.
   const float max_dist = die_area_.getPerimeter() / 2;
 
   if (isOutsideTheOutline(macro)) {
-    wirelength_ += net_weight * max_dist;
-    return;
+    return net_weight * max_dist;
   }
 
   const float x1 = macro.getPinX();
@@ -348,19 +442,24 @@ void SimulatedAnnealingCore<T>::addBoundaryDistToWirelength(
       dist_to_top = std::abs(y1 - die_area_.yMax());
     }
 
-    wirelength_
-        += net_weight
+    return net_weight
            * std::min(
                {dist_to_left, dist_to_right, dist_to_bottom, dist_to_top});
-  } else if (constraint_boundary == Boundary::L
-             || constraint_boundary == Boundary::R) {
+  }
+
+  if (constraint_boundary == Boundary::L
+      || constraint_boundary == Boundary::R) {
     const float x2 = unplaced_ios.getPinX();
-    wirelength_ += net_weight * std::abs(x2 - x1);
-  } else if (constraint_boundary == Boundary::T
-             || constraint_boundary == Boundary::B) {
+    return net_weight * std::abs(x2 - x1);
+  }
+
+  if (constraint_boundary == Boundary::T
+      || constraint_boundary == Boundary::B) {
     const float y2 = unplaced_ios.getPinY();
-    wirelength_ += net_weight * std::abs(y2 - y1);
+    return net_weight * std::abs(y2 - y1);
   }
+
+  return 0.0;
 }
 
 // We consider the macro outside the outline based on the location of
@@ -372,6 +471,13 @@ bool SimulatedAnnealingCore<T>::isOutsideTheOutline(const T& macro) const
          || macro.getPinY() > outline_.getHeight();
 }
 
+template <class T>
+typename SimulatedAnnealingCore<T>::MacroBox
+SimulatedAnnealingCore<T>::getMacroBox(const T& macro)
+{
+  return {macro.getX(), macro.getY(), macro.getWidth(), macro.getHeight()};
+}
+
 template <class T>
 void SimulatedAnnealingCore<T>::calFencePenalty()
 {
@@ -381,33 +487,21 @@ void SimulatedAnnealingCore<T>::calFencePenalty()
     return;
   }
 
+  const bool full_evaluation = evaluated_fence_boxes_.size() != fences_.size();
+  if (full_evaluation) {
+    evaluated_fence_boxes_.resize(fences_.size());
+    fence_penalties_.resize(fences_.size());
+  }
+
+  int fence_index = 0;
   for (const auto& [id, bbox] : fences_) {
-    const float lx = macros_[id].getX();
-    const float ly = macros_[id].getY();
-    const float ux = lx + macros_[id].getWidth();
-    const float uy = ly + macros_[id].getHeight();
-    // check if the macro is valid
-    if (macros_[id].getWidth() * macros_[id].getHeight() <= 1e-4) {
-      continue;
+    const MacroBox box = getMacroBox(macros_[id]);
+    if (full_evaluation || !(evaluated_fence_boxes_[fence_index] == box)) {
+      evaluated_fence_boxes_[fence_index] = box;
+      fence_penalties_[fence_index] = calMacroFencePenalty(macros_[id], bbox);
     }
-    // check if the fence is valid
-    if (macros_[id].getWidth() > (bbox.xMax() - bbox.xMin())
-        || macros_[id].getHeight() > (bbox.yMax() - bbox.yMin())) {
-      continue;
-    }
-    // check how much the macro is far from no fence violation
-    const float max_x_dist = ((bbox.xMax() - bbox.xMin()) - (ux - lx)) / 2.0;
-    const float max_y_dist = ((bbox.yMax() - bbox.yMin()) - (uy - ly)) / 2.0;
-    const float x_dist
-        = std::abs((bbox.xMin() + bbox.xMax()) / 2.0 - (lx + ux) / 2.0);
-    const float y_dist
-        = std::abs((bbox.yMin() + bbox.yMax()) / 2.0 - (ly + uy) / 2.0);
-    // calculate x and y direction independently
-    float width = x_dist <= max_x_dist ? 0.0 : (x_dist - max_x_dist);
-    float height = y_dist <= max_y_dist ? 0.0 : (y_dist - max_y_dist);
-    width = width / outline_.getWidth();
-    height = height / outline_.getHeight();
-    fence_penalty_ += width * width + height * height;
+    fence_penalty_ += fence_penalties_[fence_index];
+    fence_index++;
   }
   // normalization
   fence_penalty_ = fence_penalty_ / fences_.size();
@@ -417,6 +511,38 @@ void SimulatedAnnealingCore<T>::calFencePenalty()
   }
 }
 
+template <class T>
+float SimulatedAnnealingCore<T>::calMacroFencePenalty(const T& macro,
+                                                      const Rect& bbox) const
+{
+  const float lx = macro.getX();
+  const float ly = macro.getY();
+  const float ux = lx + macro.getWidth();
+  const float uy = ly + macro.getHeight();
+  // check if the macro is valid
+  if (macro.getWidth() * macro.getHeight() <= 1e-4) {
+    return 0.0;
+  }
+  // check if the fence is valid
+  if (macro.getWidth() > (bbox.xMax() - bbox.xMin())
+      || macro.getHeight() > (bbox.yMax() - bbox.yMin())) {
+    return 0.0;
+  }
+  // check how much the macro is far from no fence violation
+  const float max_x_dist = ((bbox.xMax() - bbox.xMin()) - (ux - lx)) / 2.0;
+  const float max_y_dist = ((bbox.yMax() - bbox.yMin()) - (uy - ly)) / 2.0;
+  const float x_dist
+      = std::abs((bbox.xMin() + bbox.xMax()) / 2.0 - (lx + ux) / 2.0);
+  const float y_dist
+      = std::abs((bbox.yMin() + bbox.yMax()) / 2.0 - (ly + uy) / 2.0);
+  // calculate x and y direction independently
+  float width = x_dist <= max_x_dist ? 0.0 : (x_dist - max_x_dist);
+  float height = y_dist <= max_y_dist ? 0.0 : (y_dist - max_y_dist);
+  width = width / outline_.getWidth();
+  height = height / outline_.getHeight();
+  return width * width + height * height;
+}
+
 template <class T>
 void SimulatedAnnealingCore<T>::calGuidancePenalty()
 {
@@ -426,27 +552,22 @@ void SimulatedAnnealingCore<T>::calGuidancePenalty()
     return;
   }
 
+  const bool full_evaluation = evaluated_guide_boxes_.size() != guides_.size();
+  if (full_evaluation) {
+    evaluated_guide_boxes_.resize(guides_.size());
+    guidance_penalties_.resize(guides_.size());
+  }
+
+  int guide_index = 0;
   for (const auto& [id, guide] : guides_) {
-    const float macro_x_min = macros_[id].getX();
-    const float macro_y_min = macros_[id].getY();
-    const float macro_x_max = macro_x_min + macros_[id].getWidth();
-    const float macro_y_max = macro_y_min + macros_[id].getHeight();
-
-    const float overlap_width = std::min(guide.xMax(), macro_x_max)
-                                - std::max(guide.xMin(), macro_x_min);
-    const float overlap_height = std::min(guide.yMax(), macro_y_max)
-                                 - std::max(guide.yMin(), macro_y_min);
-
-    // maximum overlap area
-    float penalty = std::min(macros_[id].getWidth(), guide.getWidth())
-                    * std::min(macros_[id].getHeight(), guide.getHeight());
-
-    // subtract overlap
-    if (overlap_width > 0 && overlap_height > 0) {
-      penalty -= (overlap_width * overlap_height);
+    const MacroBox box = getMacroBox(macros_[id]);
+    if (full_evaluation || !(evaluated_guide_boxes_[guide_index] == box)) {
+      evaluated_guide_boxes_[guide_index] = box;
+      guidance_penalties_[guide_index]
+          = calMacroGuidancePenalty(macros_[id], guide);
     }
-
-    guidance_penalty_ += penalty;
+    guidance_penalty_ += guidance_penalties_[guide_index];
+    guide_index++;
   }
 
   guidance_penalty_ = guidance_penalty_ / guides_.size();
@@ -459,6 +580,33 @@ void SimulatedAnnealingCore<T>::calGuidancePenalty()
   }
 }
 
+template <class T>
+float SimulatedAnnealingCore<T>::calMacroGuidancePenalty(
+    const T& macro,
+    const Rect& guide) const
+{
+  const float macro_x_min = macro.getX();
+  const float macro_y_min = macro.getY();
+  const float macro_x_max = macro_x_min + macro.getWidth();
+  const float macro_y_max = macro_y_min + macro.getHeight();
+
+  const float overlap_width = std::min(guide.xMax(), macro_x_max)
+                              - std::max(guide.xMin(), macro_x_min);
+  const float overlap_height = std::min(guide.yMax(), macro_y_max)
+                               - std::max(guide.yMin(), macro_y_min);
+
+  // maximum overlap area
+  float penalty = std::min(macro.getWidth(), guide.getWidth())
+                  * std::min(macro.getHeight(), guide.getHeight());
+
+  // subtract overlap
+  if (overlap_width > 0 && overlap_height > 0) {
+    penalty -= (overlap_width * overlap_height);
+  }
+
+  return penalty;
+}
+
 // Determine the positions of macros based on sequence pair
 template <class T>
 void SimulatedAnnealingCore<T>::packFloorplan()
@@ -468,71 +616,69 @@ void SimulatedAnnealingCore<T>::packFloorplan()
     macros_[macro_id].setY(0.0);
   }
 
+  const int sequence_size = pos_seq_.size();
+
   // Each index corresponds to a macro id whose pair is:
   // <Position in Positive Sequence , Position in Negative Sequence>
-  std::vector<std::pair<int, int>> sequence_pair_pos(pos_seq_.size());
+  sequence_pair_pos_.resize(macros_.size());
 
   // calculate X position
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    sequence_pair_pos[pos_seq_[i]].first = i;
-    sequence_pair_pos[neg_seq_[i]].second = i;
+  for (int i = 0; i < sequence_size; i++) {
+    sequence_pair_pos_[pos_seq_[i]].first = i;
+    sequence_pair_pos_[neg_seq_[i]].second = i;
   }
 
-  std::vector<float> accumulated_length(pos_seq_.size(), 0.0);
-  for (int i = 0; i < pos_seq_.size(); i++) {
+  accumulated_length_.assign(sequence_size, 0.0);
+  for (int i = 0; i < sequence_size; i++) {
     const int macro_id = pos_seq_[i];
-    const int neg_seq_pos = sequence_pair_pos[macro_id].second;
+    const int neg_seq_pos = sequence_pair_pos_[macro_id].second;
 
-    macros_[macro_id].setX(accumulated_length[neg_seq_pos]);
+    macros_[macro_id].setX(accumulated_length_[neg_seq_pos]);
 
     const float current_length
         = macros_[macro_id].getX() + macros_[macro_id].getWidth();
 
-    for (int j = neg_seq_pos; j < neg_seq_.size(); j++) {
-      if (current_length > accumulated_length[j]) {
-        accumulated_length[j] = current_length;
+    for (int j = neg_seq_pos; j < sequence_size; j++) {
+      if (current_length > accumulated_length_[j]) {
+        accumulated_length_[j] = current_length;
       } else {
         break;
       }
     }
   }
 
-  width_ = accumulated_length[pos_seq_.size() - 1];
+  width_ = accumulated_length_[sequence_size - 1];
 
-  // calulate Y position
-  std::vector<int> reversed_pos_seq(pos_seq_.size());
-  for (int i = 0; i < reversed_pos_seq.size(); i++) {
-    reversed_pos_seq[i] = pos_seq_[reversed_pos_seq.size() - 1 - i];
-  }
-
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    sequence_pair_pos[reversed_pos_seq[i]].first = i;
-    sequence_pair_pos[neg_seq_[i]].second = i;
+  // calulate Y position walking the positive sequence backwards
+  for (int i = 0; i < sequence_size; i++) {
+    sequence_pair_pos_[pos_seq_[sequence_size - 1 - i]].first = i;
+    sequence_pair_pos_[neg_seq_[i]].second = i;
 
     // This is actually the accumulated height, but we use the same vector
     // to avoid more allocation.
-    accumulated_length[i] = 0.0;
+    accumulated_length_[i] = 0.0;
   }
 
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    const int macro_id = reversed_pos_seq[i];
-    const int neg_seq_pos = sequence_pair_pos[macro_id].second;
+  for (int i = 0; i < sequence_size; i++) {
+    const int macro_id = pos_seq_[sequence_size - 1 - i];
+    const int neg_seq_pos = sequence_pair_pos_[macro_id].second;
 
-    macros_[macro_id].setY(accumulated_length[neg_seq_pos]);
+    macros_[macro_id].setY(accumulated_length_[neg_seq_pos]);
+    checkMacroMoved(macro_id);
 
     const float current_height
         = macros_[macro_id].getY() + macros_[macro_id].getHeight();
 
-    for (int j = neg_seq_pos; j < neg_seq_.size(); j++) {
-      if (current_height > accumulated_length[j]) {
-        accumulated_length[j] = current_height;
+    for (int j = neg_seq_pos; j < sequence_size; j++) {
+      if (current_height > accumulated_length_[j]) {
+        accumulated_length_[j] = current_height;
       } else {
         break;
       }
     }
   }
 
-  height_ = accumulated_length[pos_seq_.size() - 1];
+  height_ = accumulated_length_[sequence_size - 1];
 
   if (graphics_) {
     graphics_->saStep(macros_);
@@ -543,6 +689,9 @@ void SimulatedAnnealingCore<T>::packFloorplan()
 template <class T>
 void SimulatedAnnealingCore<T>::singleSeqSwap(bool pos)
 {
+  pos_seq_swap_ = {-1, -1};
+  neg_seq_swap_ = {-1, -1};
+
   if (pos_seq_.size() <= 1) {
     return;
   }
@@ -552,8 +701,10 @@ void SimulatedAnnealingCore<T>::singleSeqSwap(bool pos)
 
   if (pos) {
     std::swap(pos_seq_[index1], pos_seq_[index2]);
+    pos_seq_swap_ = {index1, index2};
   } else {
     std::swap(neg_seq_[index1], neg_seq_[index2]);
+    neg_seq_swap_ = {index1, index2};
   }
 }
 
@@ -561,6 +712,9 @@ void SimulatedAnnealingCore<T>::singleSeqSwap(bool pos)
 template <class T>
 void SimulatedAnnealingCore<T>::doubleSeqSwap()
 {
+  pos_seq_swap_ = {-1, -1};
+  neg_seq_swap_ = {-1, -1};
+
   if (pos_seq_.size() <= 1) {
     return;
   }
@@ -570,12 +724,17 @@ void SimulatedAnnealingCore<T>::doubleSeqSwap()
 
   std::swap(pos_seq_[index1], pos_seq_[index2]);
   std::swap(neg_seq_[index1], neg_seq_[index2]);
+  pos_seq_swap_ = {index1, index2};
+  neg_seq_swap_ = {index1, index2};
 }
 
 // ExchaneMacros
 template <class T>
 void SimulatedAnnealingCore<T>::exchangeMacros()
 {
+  pos_seq_swap_ = {-1, -1};
+  neg_seq_swap_ = {-1, -1};
+
   if (pos_seq_.size() <= 1) {
     return;
   }
@@ -606,6 +765,22 @@ void SimulatedAnnealingCore<T>::exchangeMacros()
                    index2);
   }
   std::swap(neg_seq_[neg_index1], neg_seq_[neg_index2]);
+  pos_seq_swap_ = {index1, index2};
+  neg_seq_swap_ = {neg_index1, neg_index2};
+}
+
+// Revert the sequence pair to its state before the last swap action.
+template <class T>
+void SimulatedAnnealingCore<T>::undoSequencePairSwaps()
+{
+  if (pos_seq_swap_.first >= 0) {
+    std::swap(pos_seq_[pos_seq_swap_.first], pos_seq_[pos_seq_swap_.second]);
+  }
+  if (neg_seq_swap_.first >= 0) {
+    std::swap(neg_seq_[neg_seq_swap_.first], neg_seq_[neg_seq_swap_.second]);
+  }
+  pos_seq_swap_ = {-1, -1};
+  neg_seq_swap_ = {-1, -1};
 }
 
 template <class T>
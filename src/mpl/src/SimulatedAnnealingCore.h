@@ -7,6 +7,7 @@
 #include <random>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "MplObserver.h"
@@ -107,12 +108,15 @@ class SimulatedAnnealingCore
   virtual void calPenalty() = 0;
   void calOutlinePenalty();
   void calWirelength();
-  void addBoundaryDistToWirelength(const T& macro,
-                                   const T& unplaced_ios,
-                                   float net_weight);
+  float calNetWirelength(const BundledNet& net) const;
+  float calBoundaryDistWirelength(const T& macro,
+                                  const T& unplaced_ios,
+                                  float net_weight) const;
   bool isOutsideTheOutline(const T& macro) const;
   void calGuidancePenalty();
   void calFencePenalty();
+  float calMacroFencePenalty(const T& macro, const Rect& fence) const;
+  float calMacroGuidancePenalty(const T& macro, const Rect& guide) const;
 
   // operations
   void packFloorplan();
@@ -123,6 +127,26 @@ class SimulatedAnnealingCore
   void doubleSeqSwap();
   void exchangeMacros();
   void generateRandomIndices(int& index1, int& index2);
+  void undoSequencePairSwaps();
+  void checkMacroMoved(int macro_id);
+  void undoWirelengthUpdate();
+
+  // Incremental evaluation
+  struct MacroBox
+  {
+    bool operator==(const MacroBox& box) const
+    {
+      return x == box.x && y == box.y && width == box.width
+             && height == box.height;
+    }
+
+    float x = 0.0;
+    float y = 0.0;
+    float width = 0.0;
+    float height = 0.0;
+  };
+
+  static MacroBox getMacroBox(const T& macro);
 
   // utilities
   static float calAverage(std::vector<float>& value_list);
@@ -146,6 +170,36 @@ class SimulatedAnnealingCore
   std::map<int, Rect> fences_;  // Macro Id -> Fence
   std::map<int, Rect> guides_;  // Macro Id -> Guide
 
+  // Caches used to evaluate the penalties incrementally. Only the
+  // nets, fences and guides touching a macro whose pin or box changed
+  // since the previous evaluation are recomputed. The wirelength is
+  // kept as a running total of the per-net terms; the fence and guide
+  // terms are summed in their original order.
+  float tot_net_weight_ = 0.0;
+  std::vector<std::vector<int>> macro_to_nets_;
+  std::vector<std::pair<float, float>> evaluated_pin_locations_;
+  std::vector<float> net_wirelengths_;
+  double net_wirelength_sum_ = 0.0;
+  std::vector<int> net_visit_stamps_;
+  int visit_stamp_ = 0;
+  // Macros whose pin may have moved since the previous evaluation.
+  // Filled by the code that moves macros (packFloorplan, etc).
+  std::vector<int> moved_macros_;
+  // Changes of the last wirelength evaluation, undone by restore().
+  std::vector<std::pair<int, float>> net_wirelength_undo_;
+  std::vector<std::pair<int, std::pair<float, float>>> pin_location_undo_;
+  double pre_net_wirelength_sum_ = 0.0;
+  bool undo_full_evaluation_ = false;
+  std::vector<MacroBox> evaluated_fence_boxes_;
+  std::vector<float> fence_penalties_;
+  std::vector<MacroBox> evaluated_guide_boxes_;
+  std::vector<float> guidance_penalties_;
+
+  // Scratch buffers reused by packFloorplan to avoid allocating
+  // on every move.
+  std::vector<std::pair<int, int>> sequence_pair_pos_;
+  std::vector<float> accumulated_length_;
+
   SACoreWeights core_weights_;
 
   float original_notch_weight_ = 0.0;
@@ -167,8 +221,10 @@ class SimulatedAnnealingCore
   std::vector<T> macros_;  // here the macros can be HardMacro or SoftMacro
 
   // previous solution
-  std::vector<int> pre_pos_seq_;
-  std::vector<int> pre_neg_seq_;
+  // The sequence pair is restored by undoing the swaps of the last
+  // perturbation instead of keeping a copy of both sequences.
+  std::pair<int, int> pos_seq_swap_{-1, -1};
+  std::pair<int, int> neg_seq_swap_{-1, -1};
   std::vector<T> pre_macros_;  // here the macros can be HardMacro or SoftMacro
   int macro_id_ = -1;          // the macro changed in the perturb
   int action_id_ = -1;         // the action_id of current step
@@ -0,0 +1,145 @@
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../src/SACoreHardMacro.h"
+#include "../../src/clusterEngine.h"
+#include "../../src/object.h"
+#include "MplTest.h"
+
+namespace mpl {
+namespace {
+
+class TestSACoreHardMacro : public MplTest
+{
+ protected:
+  void SetUp() override
+  {
+    MplTest::SetUp();
+    tree_.die_area = Rect(0, 0, 500, 500);
+
+    const float sizes[][2] = {{40, 30},
+                              {25, 50},
+                              {60, 20},
+                              {30, 30},
+                              {45, 35},
+                              {20, 60},
+                              {35, 25},
+                              {50, 40}};
+    for (int i = 0; i < std::size(sizes); i++) {
+      macros_.emplace_back(
+          sizes[i][0], sizes[i][1], "macro" + std::to_string(i));
+    }
+
+    // A chain through all macros plus a few longer connections.
+    for (int i = 0; i + 1 < macros_.size(); i++) {
+      nets_.emplace_back(i, i + 1, 1.0 + i);
+    }
+    nets_.emplace_back(0, 7, 3.0);
+    nets_.emplace_back(2, 5, 2.0);
+    nets_.emplace_back(1, 6, 4.0);
+  }
+
+  std::unique_ptr<SACoreHardMacro> makeAnnealer(const unsigned seed)
+  {
+    SACoreWeights weights;
+    weights.area = 1.0;
+    weights.outline = 1.0;
+    weights.wirelength = 1.0;
+    auto sa = std::make_unique<SACoreHardMacro>(&tree_,
+                                                outline_,
+                                                macros_,
+                                                weights,
+                                                0.2,  // pos swap
+                                                0.2,  // neg swap
+                                                0.2,  // double swap
+                                                0.2,  // exchange
+                                                0.2,  // flip
+                                                0.95,
+                                                50,
+                                                40,
+                                                seed,
+                                                nullptr,
+                                                logger_.get());
+    sa->setNets(nets_);
+    return sa;
+  }
+
+  // Wirelength of the current placement summed from scratch.
+  float fullWirelength(const SACoreHardMacro& sa) const
+  {
+    std::vector<HardMacro> macros;
+    sa.getMacros(macros);
+    double wirelength = 0.0;
+    double weight = 0.0;
+    for (const BundledNet& net : nets_) {
+      const HardMacro& source = macros[net.terminals.first];
+      const HardMacro& target = macros[net.terminals.second];
+      wirelength += net.weight
+                    * (std::abs(target.getPinX() - source.getPinX())
+                       + std::abs(target.getPinY() - source.getPinY()));
+      weight += net.weight;
+    }
+    return wirelength / weight / (outline_.getWidth() + outline_.getHeight());
+  }
+
+  PhysicalHierarchy tree_;
+  const Rect outline_{0, 0, 200, 200};
+  std::vector<HardMacro> macros_;
+  std::vector<BundledNet> nets_;
+};
+
+// The wirelength kept up to date over moved macros matches a full
+// evaluation of the final placement.
+TEST_F(TestSACoreHardMacro, IncrementalWirelengthMatchesFull)
+{
+  for (const unsigned seed : {1, 2, 3}) {
+    std::unique_ptr<SACoreHardMacro> sa = makeAnnealer(seed);
+    runSA<SACoreHardMacro>(sa.get());
+
+    const float expected = fullWirelength(*sa);
+    EXPECT_GT(expected, 0.0);
+    EXPECT_NEAR(sa->getWirelength(), expected, 1e-4 * expected);
+  }
+}
+
+// A fixed seed gives the same placement and cost.
+TEST_F(TestSACoreHardMacro, Deterministic)
+{
+  std::unique_ptr<SACoreHardMacro> sa1 = makeAnnealer(42);
+  std::unique_ptr<SACoreHardMacro> sa2 = makeAnnealer(42);
+  runSA<SACoreHardMacro>(sa1.get());
+  runSA<SACoreHardMacro>(sa2.get());
+
+  EXPECT_EQ(sa1->getNormCost(), sa2->getNormCost());
+  EXPECT_EQ(sa1->getWirelength(), sa2->getWirelength());
+  EXPECT_EQ(sa1->getOutlinePenalty(), sa2->getOutlinePenalty());
+
+  std::vector<HardMacro> macros1;
+  std::vector<HardMacro> macros2;
+  sa1->getMacros(macros1);
+  sa2->getMacros(macros2);
+  ASSERT_EQ(macros1.size(), macros2.size());
+  for (int i = 0; i < macros1.size(); i++) {
+    EXPECT_EQ(macros1[i].getX(), macros2[i].getX());
+    EXPECT_EQ(macros1[i].getY(), macros2[i].getY());
+  }
+}
+
+// Pins the floorplan found for a fixed seed so changes to the cost
+// evaluation that alter the annealing show up here.
+TEST_F(TestSACoreHardMacro, FixedSeedResult)
+{
+  std::unique_ptr<SACoreHardMacro> sa = makeAnnealer(42);
+  runSA<SACoreHardMacro>(sa.get());
+
+  EXPECT_FLOAT_EQ(sa->getWidth(), 90.0);
+  EXPECT_FLOAT_EQ(sa->getHeight(), 125.0);
+  EXPECT_NEAR(sa->getWirelength(), 0.130236, 1e-5);
+  EXPECT_NEAR(sa->getNormCost(), 0.804175, 1e-5);
+}
+
+}  // namespace
+}  // namespace mpl
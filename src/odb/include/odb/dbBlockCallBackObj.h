@@ -30,6 +30,7 @@ class dbSBox;
 class dbSWire;
 class dbMarker;
 class dbMarkerCategory;
+class dbModNet;
 
 ///////////////////////////////////////////////////////////////////////////////
 ///
@@ -82,6 +83,12 @@ class dbBlockCallBackObj
   virtual void inDbBTermSetSigType(dbBTerm*, const dbSigType&) {}
   // dbBTerm End
 
+  // dbModNet Start
+  virtual void inDbModNetDestroy(dbModNet*) {}
+  virtual void inDbModNetPostDisconnect(dbModNet*) {}
+  virtual void inDbModNetPostConnect(dbModNet*) {}
+  // dbModNet End
+
   // dbBPin Start
   virtual void inDbBPinCreate(dbBPin*) {}
   virtual void inDbBPinDestroy(dbBPin*) {}
@@ -701,6 +701,10 @@ void _dbBTerm::connectModNet(_dbModNet* mod_net, _dbBlock* block)
   }
   _prev_modnet_bterm = 0;
   mod_net->_bterms = getOID();
+
+  for (auto callback : block->_callbacks) {
+    callback->inDbModNetPostConnect((dbModNet*) mod_net);
+  }
 }
 
 void _dbBTerm::connectNet(_dbNet* net, _dbBlock* block)
@@ -880,6 +884,10 @@ void _dbBTerm::disconnectModNet(_dbBTerm* bterm, _dbBlock* block)
       }
     }
     _mnet = 0;
+
+    for (auto callback : block->_callbacks) {
+      callback->inDbModNetPostDisconnect((dbModNet*) mod_net);
+    }
   }
 }
 
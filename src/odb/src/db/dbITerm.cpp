@@ -433,6 +433,10 @@ void dbITerm::connect(dbModNet* mod_net)
   }
   iterm->_prev_modnet_iterm = 0;
   _mod_net->_iterms = iterm->getOID();
+
+  for (auto callback : block->_callbacks) {
+    callback->inDbModNetPostConnect(mod_net);
+  }
 }
 
 // disconnect both modnet and flat net from an iterm
@@ -532,6 +536,9 @@ void dbITerm::disconnect()
       }
     }
     iterm->_mnet = 0;
+    for (auto callback : block->_callbacks) {
+      callback->inDbModNetPostDisconnect((dbModNet*) mod_net);
+    }
   }
 }
 
@@ -656,6 +663,9 @@ void dbITerm::disconnectModNet()
       }
     }
     iterm->_mnet = 0;
+    for (auto callback : block->_callbacks) {
+      callback->inDbModNetPostDisconnect((dbModNet*) mod_net);
+    }
   }
 }
 
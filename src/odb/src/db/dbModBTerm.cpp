@@ -15,6 +15,7 @@
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 namespace odb {
 template class dbTable<_dbModBTerm>;
 
@@ -332,6 +333,10 @@ void dbModBTerm::connect(dbModNet* net)
   _modbterm->_prev_net_modbterm = 0;  // previous of head always zero
   _modnet->_modbterms = getId();      // set new head
 
+  for (auto callback : _block->_callbacks) {
+    callback->inDbModNetPostConnect(net);
+  }
+
   if (_block->_journal) {
     debugPrint(_modbterm->getImpl()->getLogger(),
                utl::ODB,
@@ -388,6 +393,10 @@ void dbModBTerm::disconnect()
   _modbterm->_next_net_modbterm = 0;
   _modbterm->_prev_net_modbterm = 0;
   _modbterm->_modnet = 0;
+
+  for (auto callback : block->_callbacks) {
+    callback->inDbModNetPostDisconnect((dbModNet*) mod_net);
+  }
 }
 
 bool dbModBTerm::isBusPort() const
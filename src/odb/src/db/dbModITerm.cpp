@@ -14,6 +14,7 @@
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 namespace odb {
 template class dbTable<_dbModITerm>;
 
@@ -269,6 +270,10 @@ void dbModITerm::connect(dbModNet* net)
   _moditerm->_prev_net_moditerm = 0;
   _modnet->_moditerms = getId();
 
+  for (auto callback : _block->_callbacks) {
+    callback->inDbModNetPostConnect(net);
+  }
+
   if (_block->_journal) {
     _block->_journal->beginAction(dbJournal::CONNECT_OBJECT);
     _block->_journal->pushParam(dbModITermObj);
@@ -313,6 +318,10 @@ void dbModITerm::disconnect()
     next_moditerm->_prev_net_moditerm = _moditerm->_prev_net_moditerm;
   }
   _moditerm->_mod_net = 0;
+
+  for (auto callback : _block->_callbacks) {
+    callback->inDbModNetPostDisconnect((dbModNet*) _modnet);
+  }
 }
 
 dbModITerm* dbModITerm::getModITerm(dbBlock* block, uint dbid)
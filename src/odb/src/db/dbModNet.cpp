@@ -17,6 +17,7 @@
 #include "dbTable.hpp"
 #include "dbVector.h"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 // User Code Begin Includes
 #include "dbModuleModNetBTermItr.h"
 #include "dbModuleModNetITermItr.h"
@@ -233,6 +234,10 @@ void dbModNet::destroy(dbModNet* mod_net)
   _dbBlock* block = (_dbBlock*) _modnet->getOwner();
   _dbModule* module = block->_module_tbl->getPtr(_modnet->_parent);
 
+  for (auto callback : block->_callbacks) {
+    callback->inDbModNetDestroy(mod_net);
+  }
+
   // journalling
   if (block->_journal) {
     block->_journal->beginAction(dbJournal::DELETE_OBJECT);
@@ -219,6 +219,9 @@ class PartitionMgr
       const std::vector<float>& vertex_weights,
       const std::vector<float>& hyperedge_weights);
 
+  // The number of threads used by partitioning (set_thread_count)
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+
   void readPartitioningFile(const std::string& filename,
                             const std::string& instance_map_file);
   void writePartitionVerilog(const char* file_name,
@@ -244,6 +247,7 @@ class PartitionMgr
   sta::dbNetwork* db_network_ = nullptr;
   sta::dbSta* sta_ = nullptr;
   utl::Logger* logger_ = nullptr;
+  int num_threads_ = 1;
 };
 
 }  // namespace par
@@ -39,6 +39,7 @@ Coarsener::Coarsener(const int num_parts,
                      const float adj_diff_ratio,
                      const std::vector<float>& thr_cluster_weight,
                      const int random_seed,
+                     const int num_threads,
                      const CoarsenOrder vertex_order_choice,
                      EvaluatorPtr evaluator,
                      utl::Logger* logger)
@@ -51,6 +52,7 @@ Coarsener::Coarsener(const int num_parts,
       adj_diff_ratio_(adj_diff_ratio),
       thr_cluster_weight_(thr_cluster_weight),
       random_seed_(random_seed),
+      num_threads_(num_threads),
       vertex_order_choice_(vertex_order_choice)
 {
   evaluator_ = std::move(evaluator);
@@ -299,6 +301,20 @@ void Coarsener::VertexMatching(
   }
   // shuffle the remaining vertices based on user-specified options
   OrderVertices(hgraph, unvisited);
+  // The normalized score of each hyperedge only depends on the hyperedge
+  // itself, so it is computed once in parallel instead of once per pin.
+  std::vector<float> edge_scores(hgraph->GetNumHyperedges(), 0.0);
+  ParallelFor(
+      num_threads_,
+      hgraph->GetNumHyperedges(),
+      [&](const int begin, const int end) {
+        for (int e = begin; e < end; e++) {
+          const int he_size = hgraph->Vertices(e).size();
+          if (he_size > 1 && he_size <= thr_coarsen_hyperedge_size_skip_) {
+            edge_scores[e] = evaluator_->GetNormEdgeScore(e, hgraph);
+          }
+        }
+      });
   // calculate the best vertex to cluster for current vertex
   // if the number of visited vertices is larger than
   // num_early_stop_visited_vertices, then stop the coarsening process
@@ -322,7 +338,7 @@ void Coarsener::VertexMatching(
         continue;
       }
       // get the normalized score
-      const float he_score = evaluator_->GetNormEdgeScore(he, hgraph);
+      const float he_score = edge_scores[he];
       // check the vertices in this hyperedge
       for (const int nbr_v : edge_range) {
         if (nbr_v == v) {
@@ -681,17 +697,28 @@ void Coarsener::OrderVertices(const HGraphPtr& hgraph,
       // sort the vertices based on degree of each vertex in non-decreasing
       // order i.e., number of neighboring vertices
       std::vector<int> degrees(hgraph->GetNumVertices(), 0);
-      for (const auto& v : vertices) {
-        std::set<int> nbr_vertices;
-        for (const int he : hgraph->Edges(v)) {
-          for (const int nbr : hgraph->Vertices(he)) {
-            if (nbr != v) {
-              nbr_vertices.insert(nbr);
+      ParallelFor(
+          num_threads_,
+          static_cast<int>(vertices.size()),
+          [&](const int begin, const int end) {
+            std::vector<int> nbr_vertices;
+            for (int i = begin; i < end; i++) {
+              const int v = vertices[i];
+              nbr_vertices.clear();
+              for (const int he : hgraph->Edges(v)) {
+                for (const int nbr : hgraph->Vertices(he)) {
+                  if (nbr != v) {
+                    nbr_vertices.push_back(nbr);
+                  }
+                }
+              }
+              std::sort(nbr_vertices.begin(), nbr_vertices.end());
+              degrees[v] = static_cast<int>(
+                  std::unique(nbr_vertices.begin(), nbr_vertices.end())
+                  - nbr_vertices.begin());
             }
-          }
-        }
-        degrees[v] = static_cast<int>(nbr_vertices.size());
-      }
+          },
+          1024);
       auto lambda_sort_degree
           = [&](int& x, int& y) -> bool { return degrees[x] > degrees[y]; };
       std::sort(vertices.begin(), vertices.end(), lambda_sort_degree);
@@ -734,23 +761,43 @@ HGraphPtr Coarsener::Contraction(
   std::map<size_t, std::vector<int>>
       parallel_hash_map;  // store the hyperedges_c with the same hash_value
                           // (candidate)
+  // Map the vertices of each hyperedge to their (sorted, unique) clusters.
+  // Every hyperedge is independent, so this is done in parallel; the
+  // detection of parallel hyperedges below stays serial to keep the
+  // hyperedge ordering deterministic.
+  Matrix<int> contracted_edges(hgraph->GetNumHyperedges());
+  std::vector<size_t> contracted_hashes(hgraph->GetNumHyperedges(), 0);
+  ParallelFor(
+      num_threads_,
+      hgraph->GetNumHyperedges(),
+      [&](const int begin, const int end) {
+        for (int e = begin; e < end; e++) {
+          const auto range = hgraph->Vertices(e);
+          const int he_size = range.size();
+          if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
+            continue;  // ignore the single-vertex hyperedge and large hyperedge
+          }
+          std::vector<int>& hyperedge_c = contracted_edges[e];
+          hyperedge_c.reserve(he_size);
+          for (const int vertex_id : range) {
+            hyperedge_c.push_back(vertex_cluster_id_vec[vertex_id]);
+          }
+          std::sort(hyperedge_c.begin(), hyperedge_c.end());
+          hyperedge_c.erase(std::unique(hyperedge_c.begin(), hyperedge_c.end()),
+                            hyperedge_c.end());
+          contracted_hashes[e] = std::inner_product(hyperedge_c.begin(),
+                                                    hyperedge_c.end(),
+                                                    hyperedge_c.begin(),
+                                                    static_cast<size_t>(0));
+        }
+      });
+
   for (int e = 0; e < hgraph->GetNumHyperedges(); e++) {
-    const auto range = hgraph->Vertices(e);
-    const int he_size = range.size();
-    if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
-      continue;  // ignore the single-vertex hyperedge and large hyperedge
-    }
-    std::set<int> hyperedge_c;
-    for (const int vertex_id : range) {
-      hyperedge_c.insert(vertex_cluster_id_vec[vertex_id]);  // get cluster id
-    }
+    std::vector<int>& hyperedge_c = contracted_edges[e];
     if (hyperedge_c.size() <= 1) {
       continue;  // ignore the single-vertex hyperedge
     }
-    size_t hash_value = std::inner_product(hyperedge_c.begin(),
-                                           hyperedge_c.end(),
-                                           hyperedge_c.begin(),
-                                           static_cast<size_t>(0));
+    const size_t hash_value = contracted_hashes[e];
     // check if the hash value has been used
     // for detecting parallel hyperedge
     // hyperedge_slack_c[e] = min_slack(hyperedge_arc_set_c[e])
@@ -758,8 +805,7 @@ HGraphPtr Coarsener::Contraction(
       const int hyperedge_c_id = static_cast<int>(hyperedges_c.size());
       hyperedge_cluster_id_vec[e] = hyperedge_c_id;
       hash_map[hash_value] = hyperedge_c_id;
-      hyperedges_c.push_back(
-          std::vector<int>(hyperedge_c.begin(), hyperedge_c.end()));
+      hyperedges_c.push_back(std::move(hyperedge_c));
       hyperedges_weights_c.push_back(hgraph->GetHyperedgeWeights(e));
       if (hgraph->HasTiming()) {
         hyperedge_slack_c.push_back(
@@ -773,18 +819,17 @@ HGraphPtr Coarsener::Contraction(
     // there may be parallel hyperedges
     const int hash_hyperedge_c_id
         = hash_map[hash_value];  // the hyperedge_c has been found
-    std::vector<int> hyperedge_vec(hyperedge_c.begin(), hyperedge_c.end());
     // check the representative hyperedge_c
     int parallel_hyperedge_c_id
         = -1;  // the hyperedge_c_id of parallel hyperedge
     // find the parallel_hyperedge_c_id
-    if (hyperedge_vec == hyperedges_c[hash_hyperedge_c_id]) {
+    if (hyperedge_c == hyperedges_c[hash_hyperedge_c_id]) {
       // check the representative hyperedge_c
       parallel_hyperedge_c_id = hash_hyperedge_c_id;
     } else {
       // check the parallel hyperedge_c_id
       for (const auto& candidate_id : parallel_hash_map[hash_value]) {
-        if (hyperedge_vec == hyperedges_c[candidate_id]) {
+        if (hyperedge_c == hyperedges_c[candidate_id]) {
           parallel_hyperedge_c_id = candidate_id;
           break;  // found the same hyperedge_c
         }
@@ -796,7 +841,7 @@ HGraphPtr Coarsener::Contraction(
       const int hyperedge_c_id = static_cast<int>(hyperedges_c.size());
       hyperedge_cluster_id_vec[e] = hyperedge_c_id;
       parallel_hash_map[hash_value].push_back(hyperedge_c_id);
-      hyperedges_c.push_back(hyperedge_vec);
+      hyperedges_c.push_back(std::move(hyperedge_c));
       hyperedges_weights_c.push_back(hgraph->GetHyperedgeWeights(e));
       if (hgraph->HasTiming()) {
         hyperedge_slack_c.push_back(
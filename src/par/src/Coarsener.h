@@ -61,6 +61,7 @@ class Coarsener
       const std::vector<float>&
           thr_cluster_weight,  // the weight of largest cluster in a hypergraph
       int random_seed,
+      int num_threads,
       CoarsenOrder vertex_order_choice,  // vertex order
       EvaluatorPtr evaluator,            // evaluator to calculate score
       utl::Logger* logger);
@@ -183,6 +184,7 @@ class Coarsener
 
   std::vector<float> thr_cluster_weight_;  // the maximum weight of a cluster
   int random_seed_ = 0;
+  int num_threads_ = 1;
   CoarsenOrder vertex_order_choice_ = CoarsenOrder::RANDOM;
   EvaluatorPtr evaluator_ = nullptr;
   utl::Logger* logger_ = nullptr;
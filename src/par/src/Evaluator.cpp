@@ -56,15 +56,96 @@ GoldenEvaluator::GoldenEvaluator(const int num_parts,
   logger_ = logger;
 }
 
+NetDegrees::NetDegrees(const int num_hyperedges, const int num_parts)
+    : num_hyperedges_(num_hyperedges),
+      num_parts_(num_parts),
+      pin_counts_(static_cast<size_t>(num_hyperedges) * num_parts, 0),
+      connectivity_(num_hyperedges, 0)
+{
+}
+
+void NetDegrees::InitGainCache(const HGraphPtr& hgraph,
+                               const Partitions& solution,
+                               std::vector<float> hyperedge_costs)
+{
+  hyperedge_costs_ = std::move(hyperedge_costs);
+  penalty_.assign(hgraph->GetNumVertices(), 0.0);
+  benefit_.assign(static_cast<size_t>(hgraph->GetNumVertices()) * num_parts_,
+                  0.0);
+  for (int e = 0; e < num_hyperedges_; e++) {
+    UpdateGains(hgraph, solution, e, -1, -1, 1.0);
+  }
+  has_gain_cache_ = true;
+}
+
+void NetDegrees::MoveVertex(const HGraphPtr& hgraph,
+                            const Partitions& solution,
+                            const int v,
+                            const int from_part,
+                            const int to_part)
+{
+  for (const int e : hgraph->Edges(v)) {
+    if (has_gain_cache_) {
+      UpdateGains(hgraph, solution, e, v, from_part, -1.0);
+    }
+    MovePin(e, from_part, to_part);
+    if (has_gain_cache_) {
+      UpdateGains(hgraph, solution, e, v, to_part, 1.0);
+    }
+  }
+}
+
+void NetDegrees::UpdateGains(const HGraphPtr& hgraph,
+                             const Partitions& solution,
+                             const int edge_id,
+                             const int v,
+                             const int v_part,
+                             const double sign)
+{
+  const int connectivity = connectivity_[edge_id];
+  if (connectivity == 0 || connectivity > 2) {
+    return;
+  }
+  // the blocks spanned by the hyperedge
+  int first_part = -1;
+  int second_part = -1;
+  for (int part = 0; part < num_parts_; part++) {
+    if (pin_counts_[Index(edge_id, part)] == 0) {
+      continue;
+    }
+    if (first_part < 0) {
+      first_part = part;
+    } else {
+      second_part = part;
+    }
+  }
+  const double cost = sign * hyperedge_costs_[edge_id];
+  if (connectivity == 1) {
+    // single-vertex hyperedges are never cut
+    if (pin_counts_[Index(edge_id, first_part)] > 1) {
+      for (const int u : hgraph->Vertices(edge_id)) {
+        penalty_[u] += cost;
+      }
+    }
+    return;
+  }
+  for (const int u : hgraph->Vertices(edge_id)) {
+    const int u_part = u == v ? v_part : solution[u];
+    if (pin_counts_[Index(edge_id, u_part)] == 1) {
+      const int other_part = u_part == first_part ? second_part : first_part;
+      benefit_[GainIndex(u, other_part)] += cost;
+    }
+  }
+}
+
 // calculate the vertex distribution of each net
-Matrix<int> GoldenEvaluator::GetNetDegrees(const HGraphPtr& hgraph,
-                                           const Partitions& solution) const
+NetDegrees GoldenEvaluator::GetNetDegrees(const HGraphPtr& hgraph,
+                                          const Partitions& solution) const
 {
-  Matrix<int> net_degs(hgraph->GetNumHyperedges(),
-                       std::vector<int>(num_parts_, 0));
+  NetDegrees net_degs(hgraph->GetNumHyperedges(), num_parts_);
   for (int e = 0; e < hgraph->GetNumHyperedges(); e++) {
     for (const int vertex_id : hgraph->Vertices(e)) {
-      net_degs[e][solution[vertex_id]]++;
+      net_degs.AddPin(e, solution[vertex_id]);
     }
   }
   return net_degs;
@@ -11,6 +11,7 @@
 
 #include "Hypergraph.h"
 #include "Utilities.h"
+#include "boost/range/iterator_range_core.hpp"
 #include "utl/Logger.h"
 
 namespace par {
@@ -35,6 +36,115 @@ struct PathStats
 // Partitions is the partitioning solution
 using Partitions = std::vector<int>;
 
+// The number of pins of each hyperedge in each block (pin count in part).
+// The counts are stored in one flat hyperedge-major array, and the number
+// of blocks spanned by each hyperedge is maintained as vertices move, so
+// refiners can query the connectivity of a hyperedge without rescanning it.
+//
+// The refiners can also keep a cut gain cache here.  For a vertex v in
+// block p it holds
+//   penalty(v)    : cost of the hyperedges of v lying entirely in p, which
+//                   any move of v cuts
+//   benefit(v, q) : cost of the hyperedges of v spanning only p and q in
+//                   which v is the only pin in p, which moving v to q uncuts
+// so the cut gain of moving v to q is benefit(v, q) - penalty(v).  Only
+// hyperedges spanning at most two blocks contribute, so a move updates the
+// pins of the hyperedges of the moved vertex that span at most two blocks
+// before or after the move.
+class NetDegrees
+{
+ public:
+  NetDegrees() = default;
+  NetDegrees(int num_hyperedges, int num_parts);
+
+  int GetNumHyperedges() const { return num_hyperedges_; }
+
+  // Returns the pin count of the hyperedge in each block
+  auto operator[](const int edge_id) const
+  {
+    auto begin_iter = pin_counts_.cbegin() + Index(edge_id, 0);
+    return boost::make_iterator_range(begin_iter, begin_iter + num_parts_);
+  }
+
+  // Returns the number of blocks spanned by the hyperedge
+  int GetConnectivity(const int edge_id) const
+  {
+    return connectivity_[edge_id];
+  }
+
+  void AddPin(const int edge_id, const int part)
+  {
+    if (pin_counts_[Index(edge_id, part)]++ == 0) {
+      connectivity_[edge_id]++;
+    }
+  }
+
+  // move one pin of the hyperedge from block from_part to block to_part
+  void MovePin(const int edge_id, const int from_part, const int to_part)
+  {
+    if (--pin_counts_[Index(edge_id, from_part)] == 0) {
+      connectivity_[edge_id]--;
+    }
+    AddPin(edge_id, to_part);
+  }
+
+  // Build the cut gain cache for the given solution.  hyperedge_costs is
+  // the cost of cutting each hyperedge.
+  void InitGainCache(const HGraphPtr& hgraph,
+                     const Partitions& solution,
+                     std::vector<float> hyperedge_costs);
+
+  float GetHyperedgeCost(const int edge_id) const
+  {
+    return hyperedge_costs_[edge_id];
+  }
+
+  // The cut gain of moving vertex v from its block to block to_part
+  float GetCutGain(const int v, const int to_part) const
+  {
+    return benefit_[GainIndex(v, to_part)] - penalty_[v];
+  }
+
+  // Move all the pins of vertex v from block from_part to block to_part,
+  // keeping the gain cache up to date.  solution gives the blocks of the
+  // other vertices; the entry of v itself is not read.
+  void MoveVertex(const HGraphPtr& hgraph,
+                  const Partitions& solution,
+                  int v,
+                  int from_part,
+                  int to_part);
+
+ private:
+  size_t Index(const int edge_id, const int part) const
+  {
+    return static_cast<size_t>(edge_id) * num_parts_ + part;
+  }
+
+  size_t GainIndex(const int v, const int part) const
+  {
+    return static_cast<size_t>(v) * num_parts_ + part;
+  }
+
+  // Add (sign = 1) or remove (sign = -1) the contribution of the hyperedge
+  // to the gains of its vertices, taking vertex v to be in block v_part.
+  void UpdateGains(const HGraphPtr& hgraph,
+                   const Partitions& solution,
+                   int edge_id,
+                   int v,
+                   int v_part,
+                   double sign);
+
+  int num_hyperedges_ = 0;
+  int num_parts_ = 0;
+  std::vector<int> pin_counts_;
+  std::vector<int> connectivity_;
+
+  bool has_gain_cache_ = false;
+  std::vector<float> hyperedge_costs_;
+  std::vector<double> penalty_;
+  std::vector<double> benefit_;
+};
+
 // PartitionToken is the metrics of a given partition
 struct PartitionToken
 {
@@ -74,8 +184,8 @@ class GoldenEvaluator
   virtual ~GoldenEvaluator() = default;
 
   // calculate the vertex distribution of each net
-  Matrix<int> GetNetDegrees(const HGraphPtr& hgraph,
-                            const Partitions& solution) const;
+  NetDegrees GetNetDegrees(const HGraphPtr& hgraph,
+                           const Partitions& solution) const;
 
   // Get block balance
   Matrix<float> GetBlockBalance(const HGraphPtr& hgraph,
@@ -4,7 +4,6 @@
 #include "GreedyRefine.h"
 
 #include <memory>
-#include <set>
 #include <vector>
 
 #include "Evaluator.h"
@@ -26,7 +25,7 @@ float GreedyRefine::Pass(
     const Matrix<float>& upper_block_balance,
     const Matrix<float>& lower_block_balance,
     Matrix<float>& block_balance,        // the current block balance
-    Matrix<int>& net_degs,               // the current net degree
+    NetDegrees& net_degs,                // the current net degree
     std::vector<float>& cur_paths_cost,  // the current path cost
     Partitions& solution,
     std::vector<bool>& visited_vertices_flag)
@@ -36,14 +35,8 @@ float GreedyRefine::Pass(
   for (int hyperedge_id = 0; hyperedge_id < hgraph->GetNumHyperedges();
        hyperedge_id++) {
     // check if the hyperedge is a straddled_hyperedge
-    std::set<int> block_set;
-    for (int block_id = 0; block_id < num_parts_; block_id++) {
-      if (net_degs[hyperedge_id][block_id] > 0) {
-        block_set.insert(block_id);
-      }
-    }
     // ignore the hyperedge if it's fully within one block
-    if (block_set.size() <= 1) {
+    if (net_degs.GetConnectivity(hyperedge_id) <= 1) {
       continue;
     }
     // updated the iteration
@@ -46,7 +46,7 @@ float KWayFMRefine::Pass(
     const Matrix<float>& upper_block_balance,
     const Matrix<float>& lower_block_balance,
     Matrix<float>& block_balance,        // the current block balance
-    Matrix<int>& net_degs,               // the current net degree
+    NetDegrees& net_degs,                // the current net degree
     std::vector<float>& cur_paths_cost,  // the current path cost
     Partitions& solution,
     std::vector<bool>& visited_vertices_flag)
@@ -174,7 +174,7 @@ void KWayFMRefine::InitializeGainBucketsKWay(
     GainBuckets& buckets,
     const HGraphPtr& hgraph,
     const std::vector<int>& boundary_vertices,
-    const Matrix<int>& net_degs,
+    const NetDegrees& net_degs,
     const std::vector<float>& cur_paths_cost,
     const Partitions& solution) const
 {
@@ -205,7 +205,7 @@ void KWayFMRefine::InitializeSingleGainBucket(
     int to_pid,  // move the vertex into this block (block_id = to_pid)
     const HGraphPtr& hgraph,
     const std::vector<int>& boundary_vertices,
-    const Matrix<int>& net_degs,
+    const NetDegrees& net_degs,
     const std::vector<float>& cur_paths_cost,
     const Partitions& solution) const
 {
@@ -291,7 +291,7 @@ void KWayFMRefine::AcceptKWayMove(const std::shared_ptr<VertexGain>& gain_cell,
                                   std::vector<bool>& visited_vertices_flag,
                                   const HGraphPtr& hgraph,
                                   Matrix<float>& curr_block_balance,
-                                  Matrix<int>& net_degs,
+                                  NetDegrees& net_degs,
                                   std::vector<float>& cur_paths_cost,
                                   std::vector<int>& solution) const
 {
@@ -338,7 +338,7 @@ void KWayFMRefine::UpdateSingleGainBucket(
     GainBuckets& buckets,
     const HGraphPtr& hgraph,
     const std::vector<int>& neighbors,
-    const Matrix<int>& net_degs,
+    const NetDegrees& net_degs,
     const std::vector<float>& cur_paths_cost,
     const Partitions& solution) const
 {
@@ -43,7 +43,7 @@ class KWayFMRefine : public Refiner
       int to_pid,  // move the vertex into this block (block_id = to_pid)
       const HGraphPtr& hgraph,
       const std::vector<int>& boundary_vertices,
-      const Matrix<int>& net_degs,
+      const NetDegrees& net_degs,
       const std::vector<float>& cur_paths_cost,
       const Partitions& solution) const;
 
@@ -55,7 +55,7 @@ class KWayFMRefine : public Refiner
                               GainBuckets& buckets,
                               const HGraphPtr& hgraph,
                               const std::vector<int>& neighbors,
-                              const Matrix<int>& net_degs,
+                              const NetDegrees& net_degs,
                               const std::vector<float>& cur_paths_cost,
                               const Partitions& solution) const;
 
@@ -66,7 +66,7 @@ class KWayFMRefine : public Refiner
              const Matrix<float>& upper_block_balance,
              const Matrix<float>& lower_block_balance,
              Matrix<float>& block_balance,        // the current block balance
-             Matrix<int>& net_degs,               // the current net degree
+             NetDegrees& net_degs,                // the current net degree
              std::vector<float>& cur_paths_cost,  // the current path cost
              Partitions& solution,
              std::vector<bool>& visited_vertices_flag) override;
@@ -76,7 +76,7 @@ class KWayFMRefine : public Refiner
   void InitializeGainBucketsKWay(GainBuckets& buckets,
                                  const HGraphPtr& hgraph,
                                  const std::vector<int>& boundary_vertices,
-                                 const Matrix<int>& net_degs,
+                                 const NetDegrees& net_degs,
                                  const std::vector<float>& cur_paths_cost,
                                  const Partitions& solution) const;
 
@@ -96,7 +96,7 @@ class KWayFMRefine : public Refiner
                       std::vector<bool>& visited_vertices_flag,
                       const HGraphPtr& hgraph,
                       Matrix<float>& curr_block_balance,
-                      Matrix<int>& net_degs,
+                      NetDegrees& net_degs,
                       std::vector<float>& cur_paths_cost,
                       std::vector<int>& solution) const;
 
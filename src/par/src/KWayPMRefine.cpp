@@ -44,7 +44,7 @@ float KWayPMRefine::Pass(
     const Matrix<float>& upper_block_balance,
     const Matrix<float>& lower_block_balance,
     Matrix<float>& block_balance,    // the current block balance
-    Matrix<int>& net_degs,           // the current net degree
+    NetDegrees& net_degs,            // the current net degree
     std::vector<float>& paths_cost,  // the current path cost
     Partitions& solution,
     std::vector<bool>& visited_vertices_flag)
@@ -182,7 +182,7 @@ float KWayPMRefine::PerformPairFM(
     const Matrix<float>& upper_block_balance,
     const Matrix<float>& lower_block_balance,
     Matrix<float>& block_balance,    // the current block balance
-    Matrix<int>& net_degs,           // the current net degree
+    NetDegrees& net_degs,            // the current net degree
     std::vector<float>& paths_cost,  // the current path cost
     Partitions& solution,
     GainBuckets& buckets,
@@ -304,7 +304,7 @@ void KWayPMRefine::InitializeGainBucketsPM(
     GainBuckets& buckets,
     const HGraphPtr& hgraph,
     const std::vector<int>& boundary_vertices,
-    const Matrix<int>& net_degs,
+    const NetDegrees& net_degs,
     const std::vector<float>& cur_paths_cost,
     const Partitions& solution,
     const std::pair<int, int>& partition_pair) const
@@ -47,7 +47,7 @@ class KWayPMRefine : public KWayFMRefine
              const Matrix<float>& upper_block_balance,
              const Matrix<float>& lower_block_balance,
              Matrix<float>& block_balance,        // the current block balance
-             Matrix<int>& net_degs,               // the current net degree
+             NetDegrees& net_degs,                // the current net degree
              std::vector<float>& cur_paths_cost,  // the current path cost
              Partitions& solution,
              std::vector<bool>& visited_vertices_flag) override;
@@ -63,7 +63,7 @@ class KWayPMRefine : public KWayFMRefine
       const Matrix<float>& upper_block_balance,
       const Matrix<float>& lower_block_balance,
       Matrix<float>& block_balance,    // the current block balance
-      Matrix<int>& net_degs,           // the current net degree
+      NetDegrees& net_degs,            // the current net degree
       std::vector<float>& paths_cost,  // the current path cost
       Partitions& solution,
       GainBuckets& buckets,
@@ -75,7 +75,7 @@ class KWayPMRefine : public KWayFMRefine
   void InitializeGainBucketsPM(GainBuckets& buckets,
                                const HGraphPtr& hgraph,
                                const std::vector<int>& boundary_vertices,
-                               const Matrix<int>& net_degs,
+                               const NetDegrees& net_degs,
                                const std::vector<float>& cur_paths_cost,
                                const Partitions& solution,
                                const std::pair<int, int>& partition_pair) const;
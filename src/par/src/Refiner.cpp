@@ -112,7 +112,12 @@ void Refiner::Refine(const HGraphPtr& hgraph,
   // calculate the basic statistics of current solution
   Matrix<float> cur_block_balance
       = evaluator_->GetBlockBalance(hgraph, solution);
-  Matrix<int> net_degs = evaluator_->GetNetDegrees(hgraph, solution);
+  NetDegrees net_degs = evaluator_->GetNetDegrees(hgraph, solution);
+  std::vector<float> hyperedge_costs(hgraph->GetNumHyperedges());
+  for (int e = 0; e < hgraph->GetNumHyperedges(); e++) {
+    hyperedge_costs[e] = evaluator_->CalculateHyperedgeCost(e, hgraph);
+  }
+  net_degs.InitGainCache(hgraph, solution, std::move(hyperedge_costs));
   std::vector<float> cur_paths_cost;
   if (hgraph->HasTiming()) {
     cur_paths_cost = evaluator_->GetPathsCost(hgraph, solution);
@@ -202,22 +207,13 @@ float Refiner::CalculatePathCost(int path_id,
 // The boundary vertices do not include fixed vertices
 std::vector<int> Refiner::FindBoundaryVertices(
     const HGraphPtr& hgraph,
-    const Matrix<int>& net_degs,
+    const NetDegrees& net_degs,
     const std::vector<bool>& visited_vertices_flag) const
 {
   // Step 1 : found all the boundary hyperedges
   std::vector<bool> boundary_net_flag(hgraph->GetNumHyperedges(), false);
   for (int e = 0; e < hgraph->GetNumHyperedges(); e++) {
-    int num_span_part = 0;
-    for (int i = 0; i < num_parts_; i++) {
-      if (net_degs[e][i] > 0) {
-        num_span_part++;
-        if (num_span_part >= 2) {
-          boundary_net_flag[e] = true;
-          break;
-        }
-      }
-    }
+    boundary_net_flag[e] = net_degs.GetConnectivity(e) >= 2;
   }
   // Step 2: check all the non-fixed vertices
   std::vector<int> boundary_vertices;
@@ -237,7 +233,7 @@ std::vector<int> Refiner::FindBoundaryVertices(
 
 std::vector<int> Refiner::FindBoundaryVertices(
     const HGraphPtr& hgraph,
-    const Matrix<int>& net_degs,
+    const NetDegrees& net_degs,
     const std::vector<bool>& visited_vertices_flag,
     const std::vector<int>& solution,
     const std::pair<int, int>& partition_pair) const
@@ -325,11 +321,10 @@ GainCell Refiner::CalculateVertexGain(int v,
                                       const HGraphPtr& hgraph,
                                       const std::vector<int>& solution,
                                       const std::vector<float>& cur_paths_cost,
-                                      const Matrix<int>& net_degs) const
+                                      const NetDegrees& net_degs) const
 {
   // We assume from_pid == solution[v] when we call CalculateGain
   // we need solution argument to update the score related to path
-  float cut_score = 0.0;
   float path_score = 0.0;
   std::map<int, float>
       delta_path_cost;       // map path_id to the change of path cost
@@ -337,38 +332,8 @@ GainCell Refiner::CalculateVertexGain(int v,
     return std::make_shared<VertexGain>(
         v, from_pid, to_pid, 0.0f, delta_path_cost);
   }
-  // define lambda function
-  // for checking connectivity (number of blocks connected by a hyperedge)
-  // function : check the connectivity for the hyperedge
-  auto GetConnectivity = [&](int e) {
-    int connectivity = 0;
-    for (auto& num_v : net_degs[e]) {
-      if (num_v > 0) {
-        connectivity++;
-      }
-    }
-    return connectivity;
-  };
-  // traverse all the hyperedges connected to v
-  for (const int e : hgraph->Edges(v)) {
-    const int connectivity = GetConnectivity(e);
-    const float e_score = evaluator_->CalculateHyperedgeCost(e, hgraph);
-    if (connectivity == 0) {
-      // ignore the hyperedge consisting of multiple vertices
-      // ignore single-vertex hyperedge
-      continue;
-    }
-    if (connectivity == 1 && net_degs[e][from_pid] > 1) {
-      // move from_pid to to_pid will have negative score
-      // all the vertices are with block from_id
-      cut_score -= e_score;
-    } else if (connectivity == 2 && net_degs[e][from_pid] == 1
-               && net_degs[e][to_pid] > 0) {
-      // all the vertices excluding v are all within block to_pid
-      // move from_pid to to_pid will increase the score
-      cut_score += e_score;
-    }
-  }
+  // the cut gain is kept up to date by the moves
+  const float cut_score = net_degs.GetCutGain(v, to_pid);
   // check the timing path
   if (hgraph->GetNumTimingPaths() > 0) {
     for (const int path_id : hgraph->TimingPathsThrough(v)) {
@@ -393,7 +358,7 @@ void Refiner::AcceptVertexGain(const GainCell& gain_cell,
                                std::vector<int>& solution,
                                std::vector<float>& cur_paths_cost,
                                Matrix<float>& curr_block_balance,
-                               Matrix<int>& net_degs) const
+                               NetDegrees& net_degs) const
 {
   const int vertex_id = gain_cell->GetVertex();
   visited_vertices_flag[vertex_id] = true;
@@ -413,10 +378,7 @@ void Refiner::AcceptVertexGain(const GainCell& gain_cell,
   curr_block_balance[new_part_id]
       = curr_block_balance[new_part_id] + hgraph->GetVertexWeights(vertex_id);
   // update net_degs
-  for (const int he : hgraph->Edges(vertex_id)) {
-    --net_degs[he][pre_part_id];
-    ++net_degs[he][new_part_id];
-  }
+  net_degs.MoveVertex(hgraph, solution, vertex_id, pre_part_id, new_part_id);
 }
 
 // restore one vertex based on the calculated gain_cell
@@ -426,7 +388,7 @@ void Refiner::RollBackVertexGain(const GainCell& gain_cell,
                                  std::vector<int>& solution,
                                  std::vector<float>& cur_paths_cost,
                                  Matrix<float>& curr_block_balance,
-                                 Matrix<int>& net_degs) const
+                                 NetDegrees& net_degs) const
 {
   const int vertex_id = gain_cell->GetVertex();
   visited_vertices_flag[vertex_id] = false;
@@ -445,10 +407,7 @@ void Refiner::RollBackVertexGain(const GainCell& gain_cell,
   curr_block_balance[new_part_id]
       = curr_block_balance[new_part_id] - hgraph->GetVertexWeights(vertex_id);
   // update net_degs
-  for (const int he : hgraph->Edges(vertex_id)) {
-    ++net_degs[he][pre_part_id];
-    --net_degs[he][new_part_id];
-  }
+  net_degs.MoveVertex(hgraph, solution, vertex_id, new_part_id, pre_part_id);
 }
 
 // check if we can move the vertex to some block
@@ -480,7 +439,7 @@ HyperedgeGainPtr Refiner::CalculateHyperedgeGain(
     const HGraphPtr& hgraph,
     std::vector<int>& solution,
     const std::vector<float>& cur_paths_cost,
-    const Matrix<int>& net_degs) const
+    const NetDegrees& net_degs) const
 {
   // We assume from_pid == solution[v] when we call CalculateGain
   // we need solution argument to update the score related to path
@@ -499,7 +458,8 @@ HyperedgeGainPtr Refiner::CalculateHyperedgeGain(
       vertices.emplace_back(vertex_id, solution[vertex_id]);
       for (const int e : hgraph->Edges(vertex_id)) {
         if (net_deg_map.find(e) == net_deg_map.end()) {
-          net_deg_map[e] = net_degs[e];
+          const auto pin_counts = net_degs[e];
+          net_deg_map[e].assign(pin_counts.begin(), pin_counts.end());
         }
       }
     }
@@ -528,7 +488,7 @@ HyperedgeGainPtr Refiner::CalculateHyperedgeGain(
     // traverse all the hyperedges connected to v
     for (const int e : hgraph->Edges(v)) {
       const int connectivity = GetConnectivity(e);
-      const float e_score = evaluator_->CalculateHyperedgeCost(e, hgraph);
+      const float e_score = net_degs.GetHyperedgeCost(e);
       if (connectivity == 0) {
         // ignore the hyperedge consisting of multiple vertices
         // ignore single-vertex hyperedge
@@ -585,7 +545,7 @@ void Refiner::AcceptHyperedgeGain(const HyperedgeGainPtr& hyperedge_gain,
                                   std::vector<int>& solution,
                                   std::vector<float>& cur_paths_cost,
                                   Matrix<float>& cur_block_balance,
-                                  Matrix<int>& net_degs) const
+                                  NetDegrees& net_degs) const
 {
   const int hyperedge_id = hyperedge_gain->GetHyperedge();
   total_delta_gain += hyperedge_gain->GetGain();
@@ -610,10 +570,7 @@ void Refiner::AcceptHyperedgeGain(const HyperedgeGainPtr& hyperedge_gain,
         = cur_block_balance[new_part_id] + hgraph->GetVertexWeights(vertex_id);
     // update net_degs
     // not just this hyperedge, we need to update all the related hyperedges
-    for (const int he : hgraph->Edges(vertex_id)) {
-      --net_degs[he][pre_part_id];
-      ++net_degs[he][new_part_id];
-    }
+    net_degs.MoveVertex(hgraph, solution, vertex_id, pre_part_id, new_part_id);
   }
 }
 
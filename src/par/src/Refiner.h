@@ -105,7 +105,7 @@ class Refiner
                      const Matrix<float>& upper_block_balance,
                      const Matrix<float>& lower_block_balance,
                      Matrix<float>& block_balance,  // the current block balance
-                     Matrix<int>& net_degs,         // the current net degree
+                     NetDegrees& net_degs,          // the current net degree
                      std::vector<float>& paths_cost,  // the current path cost
                      Partitions& solution,
                      std::vector<bool>& visited_vertices_flag)
@@ -124,12 +124,12 @@ class Refiner
   // fixed vertices
   std::vector<int> FindBoundaryVertices(
       const HGraphPtr& hgraph,
-      const Matrix<int>& net_degs,
+      const NetDegrees& net_degs,
       const std::vector<bool>& visited_vertices_flag) const;
 
   std::vector<int> FindBoundaryVertices(
       const HGraphPtr& hgraph,
-      const Matrix<int>& net_degs,
+      const NetDegrees& net_degs,
       const std::vector<bool>& visited_vertices_flag,
       const std::vector<int>& solution,
       const std::pair<int, int>& partition_pair) const;
@@ -165,7 +165,7 @@ class Refiner
                                const HGraphPtr& hgraph,
                                const std::vector<int>& solution,
                                const std::vector<float>& cur_paths_cost,
-                               const Matrix<int>& net_degs) const;
+                               const NetDegrees& net_degs) const;
 
   // accept the vertex gain
   void AcceptVertexGain(const GainCell& gain_cell,
@@ -175,7 +175,7 @@ class Refiner
                         std::vector<int>& solution,
                         std::vector<float>& cur_paths_cost,
                         Matrix<float>& curr_block_balance,
-                        Matrix<int>& net_degs) const;
+                        NetDegrees& net_degs) const;
 
   // restore the vertex gain
   void RollBackVertexGain(const GainCell& gain_cell,
@@ -184,7 +184,7 @@ class Refiner
                           std::vector<int>& solution,
                           std::vector<float>& cur_paths_cost,
                           Matrix<float>& curr_block_balance,
-                          Matrix<int>& net_degs) const;
+                          NetDegrees& net_degs) const;
 
   // check if we can move the vertex to some block
   bool CheckVertexMoveLegality(int v,         // vertex_id
@@ -206,7 +206,7 @@ class Refiner
       const HGraphPtr& hgraph,
       std::vector<int>& solution,
       const std::vector<float>& cur_paths_cost,
-      const Matrix<int>& net_degs) const;
+      const NetDegrees& net_degs) const;
 
   // check if we can move the hyperegde into some block
   bool CheckHyperedgeMoveLegality(
@@ -225,7 +225,7 @@ class Refiner
                            std::vector<int>& solution,
                            std::vector<float>& cur_paths_cost,
                            Matrix<float>& cur_block_balance,
-                           Matrix<int>& net_degs) const;
+                           NetDegrees& net_degs) const;
 
   // Note that there is no RollBackHyperedgeGain
   // Because we only use greedy hyperedge refinement
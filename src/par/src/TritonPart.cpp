@@ -1887,6 +1887,7 @@ void TritonPart::MultiLevelPartition()
                                     adj_diff_ratio_,
                                     thr_cluster_weight,
                                     seed_,
+                                    num_threads_,
                                     coarsen_order_,
                                     tritonpart_evaluator,
                                     logger_);
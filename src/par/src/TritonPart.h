@@ -173,6 +173,8 @@ class TritonPart
     placement_wt_factors_ = placement_wt_factors;
   }
 
+  void SetNumThreads(const int num_threads) { num_threads_ = num_threads; }
+
   // Set detailed parameters
   // There parameters only used by users who want to exploit the performance
   // limits of TritonPart
@@ -246,6 +248,9 @@ class TritonPart
   // random seed
   int seed_ = 0;
 
+  // the number of threads used by coarsening
+  int num_threads_ = 1;
+
   // ---- support for partitioning design with placed information
   // ---- for example, pin-3D flow
   bool placement_flag_
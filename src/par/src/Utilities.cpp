@@ -17,6 +17,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "ortools/linear_solver/linear_solver.h"
@@ -273,6 +274,32 @@ float norm2(const std::vector<float>& a, const std::vector<float>& factor)
   return std::sqrt(result);
 }
 
+void ParallelFor(const int max_threads,
+                 const int num_items,
+                 const std::function<void(int, int)>& func,
+                 const int min_chunk_size)
+{
+  if (num_items <= 0) {
+    return;
+  }
+  const int num_threads
+      = std::min(std::max(1, max_threads),
+                 std::max(1, num_items / std::max(1, min_chunk_size)));
+  if (num_threads <= 1) {
+    func(0, num_items);
+    return;
+  }
+  const int chunk_size = (num_items + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int begin = 0; begin < num_items; begin += chunk_size) {
+    threads.emplace_back(func, begin, std::min(num_items, begin + chunk_size));
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+}
+
 // ILP-based Partitioning Instance
 // Call ILP Solver to partition the design
 // We use Google OR-Tools as our ILP solver
@@ -6,6 +6,7 @@
 // This file includes the basic utility functions for operations
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -105,6 +106,16 @@ float norm2(const std::vector<float>& a);
 
 float norm2(const std::vector<float>& a, const std::vector<float>& factor);
 
+// Split [0, num_items) into contiguous chunks and call func(begin, end)
+// for each chunk on its own thread, using at most max_threads threads.
+// Ranges smaller than min_chunk_size are processed on the calling thread.
+// The chunks are disjoint so func may write to per-item storage without
+// locking.
+void ParallelFor(int max_threads,
+                 int num_items,
+                 const std::function<void(int, int)>& func,
+                 int min_chunk_size = 4096);
+
 // ILP-based Partitioning Instance
 // Call ILP Solver to partition the design
 bool ILPPartitionInst(
@@ -8,6 +8,7 @@
 #include <regex>
 #include <vector>
 
+#include "ord/OpenRoad.hh"
 #include "par/PartitionMgr.h"
 
 namespace ord {
@@ -77,6 +78,8 @@ void triton_part_hypergraph(unsigned int num_parts,
                             int num_vertices_threshold_ilp,
                             int global_net_threshold)
 {
+  getPartitionMgr()->setNumThreads(
+      ord::OpenRoad::openRoad()->getThreadCount());
   getPartitionMgr()->tritonPartHypergraph(
       num_parts,
       balance_constraint,
@@ -197,6 +200,8 @@ void triton_part_design(unsigned int num_parts_arg,
                         int num_vertices_threshold_ilp,
                         int global_net_threshold)
 {
+  getPartitionMgr()->setNumThreads(
+      ord::OpenRoad::openRoad()->getThreadCount());
   getPartitionMgr()->tritonPartDesign(
       num_parts_arg,
       balance_constraint_arg,
@@ -87,7 +87,7 @@ class PdnGen
                                odb::dbRegion* region);
 
   // Grids
-  void buildGrids(bool trim);
+  void buildGrids(bool trim, int threads = 1);
   std::vector<Grid*> findGrid(const std::string& name) const;
   void makeCoreGrid(VoltageDomain* domain,
                     const std::string& name,
@@ -189,6 +189,7 @@ class PdnGen
   void cleanupVias();
 
   void checkDesign(odb::dbBlock* block) const;
+  bool canBuildConcurrently(Grid* grid) const;
 
   std::vector<Grid*> getGrids() const;
   Grid* instanceGrid(odb::dbInst* inst) const;
@@ -3,6 +3,8 @@
 
 #include "pdn/PdnGen.hh"
 
+#include <algorithm>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <set>
@@ -22,6 +24,7 @@
 #include "straps.h"
 #include "techlayer.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 #include "via_repair.h"
 
 namespace pdn {
@@ -56,7 +59,12 @@ void PdnGen::resetShapes()
   updateRenderer();
 }
 
-void PdnGen::buildGrids(bool trim)
+bool PdnGen::canBuildConcurrently(Grid* grid) const
+{
+  return grid->type() == Grid::Instance && !grid->hasSwitchedPower();
+}
+
+void PdnGen::buildGrids(bool trim, int threads)
 {
   debugPrint(logger_, utl::PDN, "Make", 1, "Build - begin");
   auto* block = db_->getChip()->getBlock();
@@ -100,10 +108,13 @@ void PdnGen::buildGrids(bool trim)
   }
   all_shapes_vec.clear();
 
-  for (auto* grid : grids) {
+  auto build_grid = [&](Grid* grid) {
     debugPrint(
         logger_, utl::PDN, "Make", 2, "Build start grid - {}", grid->getName());
     grid->makeShapes(all_shapes, block_obs);
+  };
+  auto add_grid = [&](Grid* grid) {
+    grid->attachSharedVias();
     for (const auto& [layer, shapes] : grid->getShapes()) {
       auto& all_shapes_layer = all_shapes[layer];
       for (auto& shape : shapes) {
@@ -113,6 +124,59 @@ void PdnGen::buildGrids(bool trim)
     grid->getObstructions(block_obs);
     debugPrint(
         logger_, utl::PDN, "Make", 2, "Build end grid - {}", grid->getName());
+  };
+
+  // Runs of instance grids are built concurrently against the same shapes
+  // and then added in order.  A grid that overlaps one added before it in
+  // the same run did not see that grid's shapes, so it is built again.
+  // Grids are reported in order as they are added.
+  const bool concurrent = threads > 1 && debug_renderer_ == nullptr;
+  for (std::size_t begin = 0; begin < grids.size();) {
+    std::size_t end = begin + 1;
+    if (concurrent && canBuildConcurrently(grids[begin])) {
+      while (end < grids.size() && canBuildConcurrently(grids[end])) {
+        end++;
+      }
+    }
+
+    if (end - begin == 1) {
+      logger_->info(
+          utl::PDN, 1, "Inserting grid: {}", grids[begin]->getLongName());
+      build_grid(grids[begin]);
+      add_grid(grids[begin]);
+      begin = end;
+      continue;
+    }
+
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for (std::size_t i = begin; i < end; i++) {
+      try {
+        build_grid(grids[i]);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    std::vector<odb::Rect> footprints;
+    for (std::size_t i = begin; i < end; i++) {
+      Grid* grid = grids[i];
+      logger_->info(utl::PDN, 1, "Inserting grid: {}", grid->getLongName());
+      odb::Rect footprint = grid->getFootprint();
+      const bool overlaps = std::any_of(
+          footprints.begin(), footprints.end(), [&](const odb::Rect& other) {
+            return other.intersects(footprint);
+          });
+      if (overlaps) {
+        grid->resetShapes();
+        build_grid(grid);
+        footprint = grid->getFootprint();
+      }
+      footprints.push_back(footprint);
+      add_grid(grid);
+    }
+    begin = end;
   }
 
   updateVias();
@@ -4,6 +4,7 @@
 %{
 #include "pdn/PdnGen.hh"
 #include "odb/db.h"
+#include "ord/OpenRoad.hh"
 #include <array>
 #include <regex>
 #include <memory>
@@ -71,7 +72,8 @@ void reset_shapes()
 void build_grids(bool trim = true)
 {
   PdnGen* pdngen = ord::getPdnGen();
-  pdngen->buildGrids(trim);
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  pdngen->buildGrids(trim, num_threads);
 }
 
 void make_core_grid(pdn::VoltageDomain* domain, 
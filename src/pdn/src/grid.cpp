@@ -108,9 +108,6 @@ void Grid::addConnect(std::unique_ptr<Connect> connect)
 void Grid::makeShapes(const Shape::ShapeTreeMap& global_shapes,
                       const Shape::ObstructionTreeMap& obstructions)
 {
-  auto* logger = getLogger();
-  logger->info(utl::PDN, 1, "Inserting grid: {}", getLongName());
-
   // copy obstructions
   Shape::ObstructionTreeMap local_obstructions = obstructions;
 
@@ -549,6 +546,11 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
 
 void Grid::resetShapes()
 {
+  // the shapes of other grids must not keep the vias of this grid
+  for (const auto& [shape, via] : shared_vias_) {
+    shape->removeVia(via);
+  }
+  shared_vias_.clear();
   vias_.clear();
   std::set<GridComponent*> remove;
   for (auto* component : getGridComponents()) {
@@ -789,12 +791,34 @@ void Grid::makeVias(const Shape::ShapeTreeMap& global_shapes,
              remove_vias.size());
   remove_set_of_vias(remove_vias);
 
-  // build via tree
+  // build via tree, the shapes of other grids get their vias in
+  // attachSharedVias
   vias_.clear();
   for (auto& via : vias) {
     vias_.insert(via);
-    via->getLowerShape()->addVia(via);
-    via->getUpperShape()->addVia(via);
+    for (const ShapePtr& shape : {via->getLowerShape(), via->getUpperShape()}) {
+      if (!isSharedShape(shape.get())) {
+        shape->addVia(via);
+      }
+    }
+  }
+}
+
+bool Grid::isSharedShape(const Shape* shape) const
+{
+  const GridComponent* component = shape->getGridComponent();
+  return component != nullptr && component->getGrid() != this;
+}
+
+void Grid::attachSharedVias()
+{
+  for (const auto& via : vias_) {
+    for (const ShapePtr& shape : {via->getLowerShape(), via->getUpperShape()}) {
+      if (isSharedShape(shape.get())) {
+        shape->addVia(via);
+        shared_vias_.emplace_back(shape, via);
+      }
+    }
   }
 }
 
@@ -1081,6 +1105,18 @@ std::set<odb::dbTechLayer*> Grid::connectableLayers(
   return layers;
 }
 
+odb::Rect Grid::getFootprint() const
+{
+  odb::Rect footprint = getGridArea();
+  footprint.merge(getDomainBoundary());
+  for (const auto& [layer, shapes] : getShapes()) {
+    for (const auto& shape : shapes) {
+      footprint.merge(shape->getObstruction());
+    }
+  }
+  return footprint;
+}
+
 void Grid::setSwitchedPower(GridSwitchedPower* cell)
 {
   switched_power_cell_ = std::unique_ptr<GridSwitchedPower>(cell);
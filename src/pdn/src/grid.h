@@ -8,6 +8,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "odb/db.h"
@@ -94,6 +95,9 @@ class Grid
   void removeVia(const ViaPtr& via);
   // remove all vias which are invalid
   void removeInvalidVias();
+  // adds the vias of this grid to the shapes of other grids it connects to,
+  // after the grid is built so grids can be built concurrently
+  void attachSharedVias();
 
   bool startsWithPower() const { return starts_with_power_; }
   bool startsWithGround() const { return !startsWithPower(); }
@@ -154,10 +158,14 @@ class Grid
   void checkSetup() const;
 
   void setSwitchedPower(GridSwitchedPower* cell);
+  bool hasSwitchedPower() const { return switched_power_cell_ != nullptr; }
 
   void ripup();
 
   virtual std::set<odb::dbInst*> getInstances() const;
+  // returns the area covered by the grid boundaries and the obstructions of
+  // its shapes, outside of which the grid does not interact with others
+  odb::Rect getFootprint() const;
 
   bool hasShapes() const;
   bool hasVias() const;
@@ -186,9 +194,13 @@ class Grid
   std::vector<odb::dbTechLayer*> obstruction_layers_;
 
   Via::ViaTree vias_;
+  // vias of this grid added to the shapes of other grids
+  std::vector<std::pair<ShapePtr, ViaPtr>> shared_vias_;
 
   std::vector<GridComponent*> getGridComponents() const;
   void removeGridComponent(GridComponent* component);
+  // true if the shape belongs to another grid
+  bool isSharedShape(const Shape* shape) const;
   bool repairVias(const Shape::ShapeTreeMap& global_shapes,
                   Shape::ObstructionTreeMap& obstructions);
 };
@@ -98,6 +98,11 @@ odb::Rect Shape::getRectWithLargestObstructionHalo(
   return obs_rect;
 }
 
+void Shape::removeVia(const ViaPtr& via)
+{
+  vias_.erase(std::remove(vias_.begin(), vias_.end(), via), vias_.end());
+}
+
 int Shape::getNumberOfConnections() const
 {
   return vias_.size() + iterm_connections_.size() + bterm_connections_.size();
@@ -0,0 +1,48 @@
+# test for define_pdn_grid -instance built with multiple threads
+source "helpers.tcl"
+
+read_lef Nangate45/Nangate45.lef
+read_lef nangate_macros/fakeram45_64x32.lef
+
+read_def nangate_macros/floorplan.def
+
+add_global_connection -net VDD -pin_pattern {^VDD$} -power
+add_global_connection -net VDD -pin_pattern {^VDDPE$}
+add_global_connection -net VDD -pin_pattern {^VDDCE$}
+add_global_connection -net VSS -pin_pattern {^VSS$} -ground
+add_global_connection -net VSS -pin_pattern {^VSSE$}
+
+set_voltage_domain -power VDD -ground VSS
+
+define_pdn_grid -name "Core"
+add_pdn_stripe -followpins -layer metal1
+add_pdn_stripe -layer metal4 -width 0.48 -spacing 4.0 -pitch 49.0 -offset 2.0
+add_pdn_stripe -layer metal7 -width 1.4 -pitch 40.0 -offset 2.0
+
+add_pdn_connect -layers {metal1 metal4}
+add_pdn_connect -layers {metal4 metal7}
+
+define_pdn_grid -macro -name "sram1" \
+  -instances "dcache.data.data_arrays_0.data_arrays_0_ext.mem"
+add_pdn_stripe -layer metal5 -width 0.93 -pitch 10.0 -offset 2.0
+add_pdn_stripe -layer metal6 -width 0.93 -pitch 10.0 -offset 2.0
+
+add_pdn_connect -layers {metal4 metal5}
+add_pdn_connect -layers {metal5 metal6}
+add_pdn_connect -layers {metal6 metal7}
+
+define_pdn_grid -macro -name "sram2" \
+  -instances "frontend.icache.data_arrays_0.data_arrays_0_0_ext.mem"
+add_pdn_stripe -layer metal5 -width 0.93 -pitch 10.0 -offset 2.0
+add_pdn_stripe -layer metal6 -width 0.93 -pitch 10.0 -offset 2.0
+
+add_pdn_connect -layers {metal4 metal5}
+add_pdn_connect -layers {metal5 metal6}
+add_pdn_connect -layers {metal6 metal7}
+
+set_thread_count 4
+pdngen
+
+set def_file [make_result_file macros_threads.def]
+write_def $def_file
+diff_files macros.defok $def_file
@@ -107,7 +107,8 @@ class IOPlacer
   void setAnnealingConfig(float temperature,
                           int max_iterations,
                           int perturb_per_iter,
-                          float alpha);
+                          float alpha,
+                          int chains);
 
   void setRenderer(std::unique_ptr<AbstractIOPlacerRenderer> ioplacer_renderer);
   AbstractIOPlacerRenderer* getRenderer();
@@ -125,6 +126,7 @@ class IOPlacer
   static Edge getEdge(const std::string& edge);
 
  private:
+  void runAnnealingChains();
   void checkPinPlacement();
   bool checkPinConstraints();
   bool checkMirroredPins();
@@ -183,7 +185,6 @@ class IOPlacer
                           int idx,
                           std::vector<Section>& sections);
   void assignMirroredPinToSection(IOPin& io_pin);
-  int getMirroredPinCost(IOPin& io_pin, const odb::Point& position);
   int assignGroupsToSections(int& mirrored_pins_cnt);
   int updateSection(Section& section, std::vector<Slot>& slots);
   int updateConstraintSections(Constraint& constraint);
@@ -281,6 +282,7 @@ class IOPlacer
   int max_iterations_ = 0;
   int perturb_per_iter_ = 0;
   float alpha_ = 0;
+  int annealing_chains_ = 1;
 
   // simulated annealing debugger variables
   bool annealing_debug_mode_ = false;
@@ -74,6 +74,9 @@ class Parameters
   }
   std::string getPinPlacementFile() const { return pin_placement_file_; }
 
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+  int getNumThreads() const { return num_threads_; }
+
  private:
   bool report_hpwl_ = false;
   int slots_per_section_ = 200;
@@ -88,6 +91,7 @@ class Parameters
   int min_dist_ = 0;
   bool distance_in_tracks_ = false;
   std::string pin_placement_file_;
+  int num_threads_ = 1;
 };
 
 }  // namespace ppl
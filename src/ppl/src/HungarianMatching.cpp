@@ -55,6 +55,15 @@ void HungarianMatching::createMatrix()
       bool is_mirrored = false;
       std::vector<int> larger_costs;
       int slot_index = 0;
+      // The instance pins don't move during the assignment, so their bounding
+      // boxes are computed once per pin instead of once per (pin, slot) pair.
+      const odb::Rect net_bbox = netlist_->getInstPinsBBox(idx);
+      const bool has_mirrored_pin = io_pin.getBTerm()->hasMirroredBTerm();
+      odb::Rect mirrored_net_bbox;
+      if (has_mirrored_pin) {
+        mirrored_net_bbox
+            = netlist_->getInstPinsBBox(io_pin.getMirrorPinIdx());
+      }
       for (int i = begin_slot_; i <= end_slot_; ++i) {
         const Point& slot_pos = slots_[i].pos;
         if (slots_[i].blocked) {
@@ -62,8 +71,13 @@ void HungarianMatching::createMatrix()
         }
         hungarian_matrix_[slot_index].resize(num_io_pins_,
                                              std::numeric_limits<int>::max());
-        const int io_net_hpwl = netlist_->computeIONetHPWL(idx, slot_pos);
-        const int mirrored_cost = getMirroredPinCost(io_pin, slot_pos);
+        const int io_net_hpwl = Netlist::computeIONetHPWL(net_bbox, slot_pos);
+        int mirrored_cost = 0;
+        if (has_mirrored_pin) {
+          const Point mirrored_pos = core_->getMirroredPosition(slot_pos);
+          mirrored_cost
+              = Netlist::computeIONetHPWL(mirrored_net_bbox, mirrored_pos);
+        }
         const int hpwl = io_net_hpwl + mirrored_cost;
         larger_costs.push_back(std::max(io_net_hpwl, mirrored_cost));
         hungarian_matrix_[slot_index][pin_index] = hpwl;
@@ -230,20 +244,39 @@ void HungarianMatching::createMatrixForGroups()
       int slot_index = 0;
       bool is_mirrored = false;
       std::vector<int> larger_costs(valid_starting_slots_.size(), 0);
+      // As for single pins, the bounding boxes of the group's nets are
+      // computed once instead of once per starting slot.
+      std::vector<odb::Rect> net_bboxes;
+      std::vector<odb::Rect> mirrored_net_bboxes;
+      std::vector<bool> has_mirrored_pins;
+      for (const int io_idx : pins) {
+        IOPin& io_pin = netlist_->getIoPin(io_idx);
+        const bool has_mirrored_pin = io_pin.getBTerm()->hasMirroredBTerm();
+        net_bboxes.push_back(netlist_->getInstPinsBBox(io_idx));
+        mirrored_net_bboxes.push_back(
+            has_mirrored_pin
+                ? netlist_->getInstPinsBBox(io_pin.getMirrorPinIdx())
+                : odb::Rect());
+        has_mirrored_pins.push_back(has_mirrored_pin);
+      }
       for (int i : valid_starting_slots_) {
         int group_hpwl = 0;
-        for (const int io_idx : pins) {
+        for (int pin = 0; pin < pins.size(); pin++) {
           const Point& slot_pos = slots_[i].pos;
 
           hungarian_matrix_[slot_index].resize(num_pin_groups_,
                                                std::numeric_limits<int>::max());
-          IOPin& io_pin = netlist_->getIoPin(io_idx);
-          int pin_hpwl = netlist_->computeIONetHPWL(io_idx, slot_pos);
+          int pin_hpwl = Netlist::computeIONetHPWL(net_bboxes[pin], slot_pos);
           if (pin_hpwl == hungarian_fail_) {
             group_hpwl = hungarian_fail_;
             break;
           }
-          const int mirrored_cost = getMirroredPinCost(io_pin, slot_pos);
+          int mirrored_cost = 0;
+          if (has_mirrored_pins[pin]) {
+            const Point mirrored_pos = core_->getMirroredPosition(slot_pos);
+            mirrored_cost = Netlist::computeIONetHPWL(mirrored_net_bboxes[pin],
+                                                      mirrored_pos);
+          }
           group_hpwl += pin_hpwl + mirrored_cost;
           larger_costs[slot_index] += std::max(pin_hpwl, mirrored_cost);
           is_mirrored = is_mirrored || mirrored_cost != 0;
@@ -363,17 +396,6 @@ bool HungarianMatching::groupHasMirroredPin(const std::vector<int>& group)
   return false;
 }
 
-int HungarianMatching::getMirroredPinCost(IOPin& io_pin,
-                                          const odb::Point& position)
-{
-  if (io_pin.getBTerm()->hasMirroredBTerm()) {
-    odb::Point mirrored_pos = core_->getMirroredPosition(position);
-    return netlist_->computeIONetHPWL(io_pin.getMirrorPinIdx(), mirrored_pos);
-  }
-
-  return 0;
-}
-
 Edge HungarianMatching::getMirroredEdge(const Edge& edge)
 {
   Edge mirrored_edge = Edge::invalid;
@@ -70,7 +70,6 @@ class HungarianMatching
   void assignMirroredPins(IOPin& io_pin, std::vector<IOPin>& assignment);
   int getSlotIdxByPosition(const odb::Point& position, int layer) const;
   bool groupHasMirroredPin(const std::vector<int>& group);
-  int getMirroredPinCost(IOPin& io_pin, const odb::Point& position);
   Edge getMirroredEdge(const Edge& edge);
   std::vector<uint8_t> getTieBreakRank(const std::vector<int>& costs);
 };
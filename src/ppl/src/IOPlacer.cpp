@@ -27,6 +27,7 @@
 #include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
+#include "utl/exception.h"
 
 namespace ppl {
 
@@ -1341,16 +1342,34 @@ int IOPlacer::assignGroupToSection(const std::vector<int>& io_group,
     std::vector<int64_t> dst(sections.size(), 0);
     std::vector<int64_t> larger_cost(sections.size(), 0);
     std::vector<int64_t> used_slots(sections.size(), 0);
+    std::vector<odb::Rect> net_bboxes;
+    std::vector<odb::Rect> mirrored_net_bboxes;
+    std::vector<bool> has_mirrored_pins;
+    for (int pin_idx : io_group) {
+      IOPin& pin = net->getIoPin(pin_idx);
+      const bool has_mirrored_pin = pin.getBTerm()->hasMirroredBTerm();
+      net_bboxes.push_back(net->getInstPinsBBox(pin_idx));
+      mirrored_net_bboxes.push_back(
+          has_mirrored_pin ? net->getInstPinsBBox(pin.getMirrorPinIdx())
+                           : odb::Rect());
+      has_mirrored_pins.push_back(has_mirrored_pin);
+    }
     for (int i = 0; i < sections.size(); i++) {
-      for (int pin_idx : io_group) {
-        IOPin& pin = net->getIoPin(pin_idx);
-        bool has_mirrored_pin = pin.getBTerm()->hasMirroredBTerm();
-        int pin_hpwl = net->computeIONetHPWL(pin_idx, sections[i].pos);
+      const odb::Point& section_pos = sections[i].pos;
+      for (int pin = 0; pin < group_size; pin++) {
+        const bool has_mirrored_pin = has_mirrored_pins[pin];
+        int pin_hpwl = Netlist::computeIONetHPWL(net_bboxes[pin], section_pos);
         if (pin_hpwl == std::numeric_limits<int>::max()) {
           dst[i] = pin_hpwl;
           break;
         }
-        const int mirrored_pin_cost = getMirroredPinCost(pin, sections[i].pos);
+        int mirrored_pin_cost = 0;
+        if (has_mirrored_pin) {
+          const odb::Point mirrored_pos
+              = core_->getMirroredPosition(section_pos);
+          mirrored_pin_cost = Netlist::computeIONetHPWL(
+              mirrored_net_bboxes[pin], mirrored_pos);
+        }
         dst[i] += pin_hpwl + mirrored_pin_cost;
         if (has_mirrored_pin) {
           larger_cost[i] += std::max(pin_hpwl, mirrored_pin_cost);
@@ -1503,9 +1522,20 @@ bool IOPlacer::assignPinToSection(IOPin& io_pin,
     std::vector<int> larger_cost(sections.size());
     std::vector<int> used_slots(sections.size());
 
+    const odb::Rect net_bbox = netlist_->getInstPinsBBox(idx);
+    odb::Rect mirrored_net_bbox;
+    if (has_mirrored_pin) {
+      mirrored_net_bbox = netlist_->getInstPinsBBox(io_pin.getMirrorPinIdx());
+    }
     for (int i = 0; i < sections.size(); i++) {
-      const int io_net_hpwl = netlist_->computeIONetHPWL(idx, sections[i].pos);
-      const int mirrored_pin_cost = getMirroredPinCost(io_pin, sections[i].pos);
+      const odb::Point& section_pos = sections[i].pos;
+      const int io_net_hpwl = Netlist::computeIONetHPWL(net_bbox, section_pos);
+      int mirrored_pin_cost = 0;
+      if (has_mirrored_pin) {
+        const odb::Point mirrored_pos = core_->getMirroredPosition(section_pos);
+        mirrored_pin_cost
+            = Netlist::computeIONetHPWL(mirrored_net_bbox, mirrored_pos);
+      }
       dst[i] = io_net_hpwl + mirrored_pin_cost;
 
       if (has_mirrored_pin) {
@@ -1541,15 +1571,6 @@ void IOPlacer::assignMirroredPinToSection(IOPin& io_pin)
   mirrored_pin.assignToSection();
 }
 
-int IOPlacer::getMirroredPinCost(IOPin& io_pin, const odb::Point& position)
-{
-  if (io_pin.getBTerm()->hasMirroredBTerm()) {
-    odb::Point mirrored_pos = core_->getMirroredPosition(position);
-    return netlist_->computeIONetHPWL(io_pin.getMirrorPinIdx(), mirrored_pos);
-  }
-  return 0;
-}
-
 void IOPlacer::printConfig(bool annealing)
 {
   int available_slots = 0;
@@ -2207,9 +2228,18 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     updateSection(sec, slots);
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignment();
+  // Sections are independent once the groups have been assigned, so their
+  // cost matrices are built and solved concurrently.
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(parms_->getNumThreads()) schedule(dynamic)
+  for (int i = 0; i < hg_vec.size(); i++) {
+    try {
+      hg_vec[i].findAssignment();
+    } catch (...) {
+      exception.capture();
+    }
   }
+  exception.rethrow();
 
   for (bool mirrored_pins : {true, false}) {
     for (auto& match : hg_vec) {
@@ -2333,12 +2363,14 @@ void IOPlacer::runHungarianMatching(bool random_mode)
 void IOPlacer::setAnnealingConfig(float temperature,
                                   int max_iterations,
                                   int perturb_per_iter,
-                                  float alpha)
+                                  float alpha,
+                                  int chains)
 {
   init_temperature_ = temperature;
   max_iterations_ = max_iterations;
   perturb_per_iter_ = perturb_per_iter;
   alpha_ = alpha;
+  annealing_chains_ = chains;
 }
 
 void IOPlacer::setRenderer(
@@ -2384,18 +2416,22 @@ void IOPlacer::runAnnealing(bool random)
   initMirroredPins(true);
   initConstraints(true);
 
-  ppl::SimulatedAnnealing annealing(
-      netlist_.get(), core_.get(), slots_, constraints_, logger_, db_);
+  printConfig(true);
 
-  if (isAnnealingDebugOn()) {
-    annealing.setDebugOn(std::move(ioplacer_renderer_));
-  }
+  if (annealing_chains_ > 1 && !random && !isAnnealingDebugOn()) {
+    runAnnealingChains();
+  } else {
+    ppl::SimulatedAnnealing annealing(
+        netlist_.get(), core_.get(), slots_, constraints_, logger_, db_);
 
-  printConfig(true);
+    if (isAnnealingDebugOn()) {
+      annealing.setDebugOn(std::move(ioplacer_renderer_));
+    }
 
-  annealing.run(
-      init_temperature_, max_iterations_, perturb_per_iter_, alpha_, random);
-  annealing.getAssignment(assignment_);
+    annealing.run(
+        init_temperature_, max_iterations_, perturb_per_iter_, alpha_, random);
+    annealing.getAssignment(assignment_);
+  }
 
   for (auto& pin : assignment_) {
     updateOrientation(pin);
@@ -2410,6 +2446,52 @@ void IOPlacer::runAnnealing(bool random)
   clear();
 }
 
+void IOPlacer::runAnnealingChains()
+{
+  // Each chain anneals its own copy of the netlist and slots, as the
+  // perturbations reorder pin groups and mark slots as used. The first chain
+  // uses the default seed, so the result is never worse than a single chain.
+  std::vector<std::unique_ptr<Netlist>> netlists;
+  std::vector<std::vector<Slot>> slots(annealing_chains_, slots_);
+  std::vector<std::unique_ptr<SimulatedAnnealing>> chains;
+  for (int i = 0; i < annealing_chains_; i++) {
+    netlists.push_back(std::make_unique<Netlist>(*netlist_));
+    chains.push_back(std::make_unique<SimulatedAnnealing>(
+        netlists[i].get(), core_.get(), slots[i], constraints_, logger_, db_));
+    chains[i]->setSeed(chains[i]->getSeed() + i);
+  }
+
+  std::vector<int64> costs(annealing_chains_);
+  const int num_threads = std::min(parms_->getNumThreads(), annealing_chains_);
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+  for (int i = 0; i < annealing_chains_; i++) {
+    try {
+      chains[i]->run(
+          init_temperature_, max_iterations_, perturb_per_iter_, alpha_, false);
+      costs[i] = chains[i]->getAssignmentCost();
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  const int best_chain
+      = std::min_element(costs.begin(), costs.end()) - costs.begin();
+  debugPrint(logger_,
+             utl::PPL,
+             "annealing",
+             1,
+             "Best annealing chain: {} of {}; HPWL: {}um",
+             best_chain,
+             annealing_chains_,
+             getBlock()->dbuToMicrons(costs[best_chain]));
+
+  chains[best_chain]->getAssignment(assignment_);
+  netlist_ = std::move(netlists[best_chain]);
+  slots_ = std::move(slots[best_chain]);
+}
+
 void IOPlacer::checkPinPlacement()
 {
   bool invalid = false;
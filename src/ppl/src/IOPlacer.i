@@ -156,6 +156,8 @@ add_ver_layer(odb::dbTechLayer* layer)
 void
 run_hungarian_matching(bool randomMode)
 {
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  getIOPlacer()->getParameters()->setNumThreads(num_threads);
   getIOPlacer()->runHungarianMatching(randomMode);
 }
 
@@ -236,9 +238,10 @@ void
 set_simulated_annealing(float temperature,
                         int max_iterations,
                         int perturb_per_iter,
-                        float alpha)
+                        float alpha,
+                        int chains)
 {
-  getIOPlacer()->setAnnealingConfig(temperature, max_iterations, perturb_per_iter, alpha);
+  getIOPlacer()->setAnnealingConfig(temperature, max_iterations, perturb_per_iter, alpha, chains);
 }
 
 void
@@ -262,6 +265,8 @@ simulated_annealing_debug(int iters_between_paintings,
 void
 run_annealing(bool random)
 {
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  getIOPlacer()->getParameters()->setNumThreads(num_threads);
   getIOPlacer()->runAnnealing(random);
 }
 
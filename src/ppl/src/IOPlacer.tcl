@@ -61,12 +61,14 @@ proc set_pin_thick_multiplier { args } {
 sta::define_cmd_args "set_simulated_annealing" {[-temperature temperature]\
                                                 [-max_iterations iters]\
                                                 [-perturb_per_iter perturbs]\
-                                                [-alpha alpha]
+                                                [-alpha alpha]\
+                                                [-chains chains]
 }
 
 proc set_simulated_annealing { args } {
   sta::parse_key_args "set_simulated_annealing" args \
-    keys {-temperature -max_iterations -perturb_per_iter -alpha} flags {}
+    keys {-temperature -max_iterations -perturb_per_iter -alpha -chains} \
+    flags {}
 
   set temperature 0
   if { [info exists keys(-temperature)] } {
@@ -92,7 +94,14 @@ proc set_simulated_annealing { args } {
     sta::check_positive_float "-alpha" $alpha
   }
 
-  ppl::set_simulated_annealing $temperature $max_iterations $perturb_per_iter $alpha
+  set chains 1
+  if { [info exists keys(-chains)] } {
+    set chains $keys(-chains)
+    sta::check_positive_int "-chains" $chains
+  }
+
+  ppl::set_simulated_annealing $temperature $max_iterations $perturb_per_iter \
+    $alpha $chains
 }
 
 sta::define_cmd_args "simulated_annealing_debug" {
@@ -123,6 +123,29 @@ int Netlist::computeIONetHPWL(int idx, const Point& slot_pos)
   return (x + y);
 }
 
+int Netlist::computeIONetHPWL(const Rect& inst_pins_bbox,
+                              const Point& slot_pos)
+{
+  Rect net_bbox = inst_pins_bbox;
+  net_bbox.merge(slot_pos);
+
+  return net_bbox.dx() + net_bbox.dy();
+}
+
+Rect Netlist::getInstPinsBBox(int idx) const
+{
+  int net_start = net_pointer_[idx];
+  int net_end = net_pointer_[idx + 1];
+
+  Rect inst_pins_bbox;
+  inst_pins_bbox.mergeInit();
+  for (int idx = net_start; idx < net_end; ++idx) {
+    inst_pins_bbox.merge(inst_pins_[idx].getPos());
+  }
+
+  return inst_pins_bbox;
+}
+
 int Netlist::computeDstIOtoPins(int idx, const Point& slot_pos)
 {
   int net_start = net_pointer_[idx];
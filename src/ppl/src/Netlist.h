@@ -168,6 +168,14 @@ class Netlist
   void getSinksOfIO(int idx, std::vector<InstancePin>& sinks);
 
   int computeIONetHPWL(int idx, const odb::Point& slot_pos);
+  // HPWL of a net whose instance pins are bounded by inst_pins_bbox when its
+  // IO pin is placed at slot_pos. Used to evaluate many candidate slots
+  // without rescanning the instance pins of the net.
+  static int computeIONetHPWL(const odb::Rect& inst_pins_bbox,
+                              const odb::Point& slot_pos);
+  // Bounding box of the instance pins connected to the IO pin idx. The box is
+  // inverted (see odb::Rect::mergeInit) when the net has no instance pins.
+  odb::Rect getInstPinsBBox(int idx) const;
   int computeDstIOtoPins(int idx, const odb::Point& slot_pos);
   void sortPinsFromGroup(int group_idx, Edge edge);
   odb::Rect getBB(int idx, const odb::Point& slot_pos);
@@ -34,6 +34,10 @@ SimulatedAnnealing::SimulatedAnnealing(
   num_slots_ = slots.size();
   num_pins_ = netlist->numIOPins();
   num_groups_ = pin_groups_.size();
+  net_bboxes_.reserve(num_pins_);
+  for (int i = 0; i < num_pins_; i++) {
+    net_bboxes_.push_back(netlist_->getInstPinsBBox(i));
+  }
   countLonePins();
   perturb_per_iter_ = static_cast<int>(lone_pins_ * 0.8 + num_groups_ * 10);
 }
@@ -337,7 +341,7 @@ int SimulatedAnnealing::getPinCost(int pin_idx)
 {
   int slot_idx = pin_assignment_[pin_idx];
   const odb::Point& position = slots_[slot_idx].pos;
-  return netlist_->computeIONetHPWL(pin_idx, position);
+  return Netlist::computeIONetHPWL(net_bboxes_[pin_idx], position);
 }
 
 int64 SimulatedAnnealing::getGroupCost(int group_idx)
@@ -346,7 +350,7 @@ int64 SimulatedAnnealing::getGroupCost(int group_idx)
   for (int pin_idx : pin_groups_[group_idx].pin_indices) {
     int slot_idx = pin_assignment_[pin_idx];
     const odb::Point& position = slots_[slot_idx].pos;
-    cost += netlist_->computeIONetHPWL(pin_idx, position);
+    cost += Netlist::computeIONetHPWL(net_bboxes_[pin_idx], position);
   }
 
   return cost;
@@ -54,6 +54,9 @@ class SimulatedAnnealing
            float alpha,
            bool random);
   void getAssignment(std::vector<IOPin>& assignment);
+  int64 getAssignmentCost();
+  void setSeed(int seed) { seed_ = seed; }
+  int getSeed() const { return seed_; }
 
   // debug functions
   void setDebugOn(std::unique_ptr<AbstractIOPlacerRenderer> renderer);
@@ -73,7 +76,6 @@ class SimulatedAnnealing
   void randomAssignment();
   int randomAssignmentForGroups(std::set<int>& placed_pins,
                                 const std::vector<int>& slot_indices);
-  int64 getAssignmentCost();
   int getDeltaCost(int prev_cost);
   int getPinCost(int pin_idx);
   int64 getGroupCost(int group_idx);
@@ -106,6 +108,9 @@ class SimulatedAnnealing
   // [pin] -> slot
   std::vector<int> pin_assignment_;
   std::vector<int> slot_indices_;
+  // [pin] -> bounding box of the instance pins of its net. Only the IO pins
+  // move during annealing, so the boxes are computed once.
+  std::vector<odb::Rect> net_bboxes_;
   Netlist* netlist_;
   Core* core_;
   std::vector<Slot>& slots_;
@@ -137,7 +142,7 @@ class SimulatedAnnealing
   Logger* logger_ = nullptr;
   odb::dbDatabase* db_;
   const int fail_cost_ = std::numeric_limits<int>::max();
-  const int seed_ = 42;
+  int seed_ = 42;
 
   // debug variables
   std::unique_ptr<DebugSettings> debug_;
@@ -0,0 +1,35 @@
+# gcd_nangate45 IO placement with parallel annealing chains
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def gcd.def
+
+# The annealing seeds are fixed, so the chain kept is reproducible. Its
+# HPWL is not pinned here.
+suppress_message PPL 12
+
+set_simulated_annealing -chains 4
+set_thread_count 4
+
+place_pins -hor_layers metal3 -ver_layers metal4 -annealing
+
+set def_file1 [make_result_file annealing_chains1.def]
+
+write_def $def_file1
+
+place_pins -hor_layers metal3 -ver_layers metal4 -annealing
+
+set def_file2 [make_result_file annealing_chains2.def]
+
+write_def $def_file2
+
+# The chain kept doesn't depend on how many run at once.
+set_thread_count 1
+
+place_pins -hor_layers metal3 -ver_layers metal4 -annealing
+
+set def_file3 [make_result_file annealing_chains3.def]
+
+write_def $def_file3
+
+diff_files $def_file1 $def_file2
+diff_files $def_file1 $def_file3
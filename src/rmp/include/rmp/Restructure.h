@@ -66,6 +66,8 @@ class Restructure
            char* abc_logfile);
 
   void setMode(const char* mode_name);
+  // Hand the extracted logic to ABC in memory instead of through BLIF files.
+  void setAbcInMemory(bool in_memory);
   void setTieLoPort(sta::LibertyPort* loport);
   void setTieHiPort(sta::LibertyPort* hiport);
 
@@ -73,9 +75,11 @@ class Restructure
   void deleteComponents();
   void getBlob(unsigned max_depth);
   void runABC();
+  void runAbcInMemory(unsigned max_depth);
   void postABC(float worst_slack);
   bool writeAbcScript(std::string file_name);
   void writeOptCommands(std::ofstream& script);
+  std::vector<std::string> getOptCommands(Mode mode) const;
   void initDB();
   void getEndPoints(sta::PinSet& ends, bool area_mode, unsigned max_depth);
   int countConsts(odb::dbBlock* top_block);
@@ -105,6 +109,7 @@ class Restructure
 
   Mode opt_mode_;
   bool is_area_mode_;
+  bool abc_in_memory_ = false;
   int blif_call_id_{0};
 };
 
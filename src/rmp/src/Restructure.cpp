@@ -15,14 +15,21 @@
 #include <sstream>
 #include <vector>
 
+#include "abc_library_factory.h"
 #include "base/abc/abc.h"
 #include "base/main/abcapis.h"
+#include "base/main/main.h"
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
+#include "delay_optimization_strategy.h"
+#include "logic_cut.h"
+#include "logic_extractor.h"
+#include "map/mio/mio.h"
 #include "odb/db.h"
 #include "ord/OpenRoad.hh"
 #include "rmp/blif.h"
 #include "sta/Graph.hh"
+#include "sta/GraphDelayCalc.hh"
 #include "sta/Liberty.hh"
 #include "sta/Network.hh"
 #include "sta/PathEnd.hh"
@@ -33,6 +40,7 @@
 #include "sta/Search.hh"
 #include "sta/Sta.hh"
 #include "utl/Logger.h"
+#include "utl/deleter.h"
 #include "zero_slack_strategy.h"
 
 using utl::RMP;
@@ -97,6 +105,12 @@ void Restructure::run(char* liberty_file_name,
   if (is_area_mode_)  // Only in area mode
     removeConstCells();
 
+  if (abc_in_memory_) {
+    runAbcInMemory(max_depth);
+    postABC(worst_slack);
+    return;
+  }
+
   getBlob(max_depth);
 
   if (path_insts_.size()) {
@@ -284,6 +298,118 @@ void Restructure::runABC()
   }
 }
 
+void Restructure::runAbcInMemory(unsigned max_depth)
+{
+  open_sta_->ensureGraph();
+  open_sta_->ensureLevelized();
+  open_sta_->searchPreamble();
+
+  sta::dbNetwork* network = open_sta_->getDbNetwork();
+  sta::PinSet ends(network);
+  getEndPoints(ends, is_area_mode_, max_depth);
+  if (ends.empty()) {
+    return;
+  }
+
+  // Disable incremental timing.
+  open_sta_->graphDelayCalc()->delaysInvalid();
+  open_sta_->search()->arrivalsInvalid();
+  open_sta_->search()->endpointsInvalid();
+
+  AbcLibraryFactory factory(logger_);
+  factory.AddDbSta(open_sta_);
+  factory.SetCorner(open_sta_->cmdCorner());
+  AbcLibrary abc_library = factory.Build();
+
+  LogicExtractorFactory logic_extractor(open_sta_, logger_);
+  sta::Graph* graph = open_sta_->graph();
+  for (const sta::Pin* pin : ends) {
+    logic_extractor.AppendEndpoint(graph->pinLoadVertex(pin));
+  }
+  LogicCut cut = logic_extractor.BuildLogicCut(abc_library);
+  if (cut.IsEmpty()) {
+    logger_->info(RMP, 38, "No logic extracted for restructuring.");
+    return;
+  }
+  logger_->report("Found {} instances for restructuring.",
+                  cut.cut_instances().size());
+
+  utl::UniquePtrWithDeleter<abc::Abc_Ntk_t> mapped_network
+      = cut.BuildMappedAbcNetwork(abc_library, network, logger_);
+
+  // ABC commands act on the single global frame, so the modes are run one
+  // after the other.  Only DELAY_4 is used in delay mode as the other delay
+  // modes are not showing good gains.
+  std::vector<Mode> modes;
+  if (is_area_mode_) {
+    modes = {Mode::AREA_1, Mode::AREA_2, Mode::AREA_3};
+  } else {
+    modes = {Mode::DELAY_4};
+  }
+
+  utl::UniquePtrWithDeleter<abc::Abc_Ntk_t> best_network(nullptr,
+                                                         &Abc_NtkDelete);
+  int best_inst_count = std::numeric_limits<int>::max();
+
+  const std::lock_guard<std::mutex> lock(abc_library_mutex);
+  Abc_Frame_t* abc_frame = Abc_FrameGetGlobalFrame();
+  auto library = static_cast<Mio_Library_t*>(mapped_network->pManFunc);
+  Abc_FrameSetLibGen(library);
+
+  for (size_t curr_mode_idx = 0; curr_mode_idx < modes.size();
+       curr_mode_idx++) {
+    Abc_FrameReplaceCurrentNetwork(abc_frame,
+                                   Abc_NtkToLogic(mapped_network.get()));
+
+    bool success = true;
+    for (const std::string& command : getOptCommands(modes[curr_mode_idx])) {
+      if (command == "buffer -p -c") {
+        // The SC library only lives in abc_library, not in the frame.
+        utl::UniquePtrWithDeleter<abc::Abc_Ntk_t> buffered
+            = BufferNetwork(Abc_FrameReadNtk(abc_frame), abc_library);
+        Abc_FrameReplaceCurrentNetwork(abc_frame, buffered.release());
+      } else if (Cmd_CommandExecute(abc_frame, command.c_str())) {
+        logger_->warn(RMP,
+                      39,
+                      "ABC command {} failed in iteration {}.",
+                      command,
+                      curr_mode_idx);
+        success = false;
+        break;
+      }
+    }
+    if (!success) {
+      continue;
+    }
+
+    Abc_Ntk_t* result = Abc_FrameReadNtk(abc_frame);
+    const int num_instances = Abc_NtkNodeNum(result);
+    logger_->report(
+        "Optimized to {} instances in iteration {} with max path depth of {}.",
+        num_instances,
+        curr_mode_idx,
+        Abc_NtkLevel(result));
+
+    if (!is_area_mode_ || num_instances < best_inst_count) {
+      best_inst_count = num_instances;
+      best_network.reset(Abc_NtkToNetlist(result));
+    }
+  }
+
+  // The frame's networks and library point into abc_library, which is
+  // destroyed on return.
+  Abc_FrameDeleteAllNetworks(abc_frame);
+  Abc_FrameSetLibGen(nullptr);
+
+  if (best_network) {
+    cut.InsertMappedAbcNetwork(
+        best_network.get(), abc_library, network, name_generator_, logger_);
+  } else {
+    logger_->info(
+        RMP, 21, "All re-synthesis runs discarded, keeping original netlist.");
+  }
+}
+
 void Restructure::postABC(float worst_slack)
 {
   // Leave the parasitics up to date.
@@ -496,71 +622,84 @@ bool Restructure::writeAbcScript(std::string file_name)
 
 void Restructure::writeOptCommands(std::ofstream& script)
 {
-  std::string choice
-      = "alias choice \"fraig_store; resyn2; fraig_store; resyn2; fraig_store; "
-        "fraig_restore\"";
-  std::string choice2
-      = "alias choice2 \"fraig_store; balance; fraig_store; resyn2; "
-        "fraig_store; resyn2; fraig_store; resyn2; fraig_store; "
-        "fraig_restore\"";
-  script << "bdd; sop" << std::endl;
-
-  script << "alias resyn2 \"balance; rewrite; refactor; balance; rewrite; "
-            "rewrite -z; balance; refactor -z; rewrite -z; balance\""
-         << std::endl;
-  script << choice << std::endl;
-  script << choice2 << std::endl;
-
-  if (opt_mode_ == Mode::AREA_3)
-    script << "choice2" << std::endl;  // << "scleanup" << std::endl;
+  for (const std::string& command : getOptCommands(opt_mode_)) {
+    script << command << std::endl;
+  }
+}
+
+std::vector<std::string> Restructure::getOptCommands(Mode mode) const
+{
+  std::vector<std::string> commands;
+  commands.emplace_back("bdd; sop");
+  commands.emplace_back(
+      "alias resyn2 \"balance; rewrite; refactor; balance; rewrite; "
+      "rewrite -z; balance; refactor -z; rewrite -z; balance\"");
+  commands.emplace_back(
+      "alias choice \"fraig_store; resyn2; fraig_store; resyn2; fraig_store; "
+      "fraig_restore\"");
+  commands.emplace_back(
+      "alias choice2 \"fraig_store; balance; fraig_store; resyn2; "
+      "fraig_store; resyn2; fraig_store; resyn2; fraig_store; "
+      "fraig_restore\"");
+
+  if (mode == Mode::AREA_3)
+    commands.emplace_back("choice2");
   else
-    script << "resyn2" << std::endl;  // << "scleanup" << std::endl;
+    commands.emplace_back("resyn2");
 
-  switch (opt_mode_) {
+  switch (mode) {
     case Mode::DELAY_1: {
-      script << "map -D 0.01 -A 0.9 -B 0.2 -M 0 -p" << std::endl;
-      script << "buffer -p -c" << std::endl;
+      commands.emplace_back("map -D 0.01 -A 0.9 -B 0.2 -M 0 -p");
+      commands.emplace_back("buffer -p -c");
       break;
     }
     case Mode::DELAY_2: {
-      script << "choice" << std::endl;
-      script << "map -D 0.01 -A 0.9 -B 0.2 -M 0 -p" << std::endl;
-      script << "choice" << std::endl;
-      script << "map -D 0.01" << std::endl;
-      script << "buffer -p -c" << std::endl << "topo" << std::endl;
+      commands.emplace_back("choice");
+      commands.emplace_back("map -D 0.01 -A 0.9 -B 0.2 -M 0 -p");
+      commands.emplace_back("choice");
+      commands.emplace_back("map -D 0.01");
+      commands.emplace_back("buffer -p -c");
+      commands.emplace_back("topo");
       break;
     }
     case Mode::DELAY_3: {
-      script << "choice2" << std::endl;
-      script << "map -D 0.01 -A 0.9 -B 0.2 -M 0 -p" << std::endl;
-      script << "choice2" << std::endl;
-      script << "map -D 0.01" << std::endl;
-      script << "buffer -p -c" << std::endl << "topo" << std::endl;
+      commands.emplace_back("choice2");
+      commands.emplace_back("map -D 0.01 -A 0.9 -B 0.2 -M 0 -p");
+      commands.emplace_back("choice2");
+      commands.emplace_back("map -D 0.01");
+      commands.emplace_back("buffer -p -c");
+      commands.emplace_back("topo");
       break;
     }
     case Mode::DELAY_4: {
-      script << "choice2" << std::endl;
-      script << "amap -F 20 -A 20 -C 5000 -Q 0.1 -m" << std::endl;
-      script << "choice2" << std::endl;
-      script << "map -D 0.01 -A 0.9 -B 0.2 -M 0 -p" << std::endl;
-      script << "buffer -p -c" << std::endl;
+      commands.emplace_back("choice2");
+      commands.emplace_back("amap -F 20 -A 20 -C 5000 -Q 0.1 -m");
+      commands.emplace_back("choice2");
+      commands.emplace_back("map -D 0.01 -A 0.9 -B 0.2 -M 0 -p");
+      commands.emplace_back("buffer -p -c");
       break;
     }
     case Mode::AREA_2:
     case Mode::AREA_3: {
-      script << "choice2" << std::endl;
-      script << "amap -m -Q 0.1 -F 20 -A 20 -C 5000" << std::endl;
-      script << "choice2" << std::endl;
-      script << "amap -m -Q 0.1 -F 20 -A 20 -C 5000" << std::endl;
+      commands.emplace_back("choice2");
+      commands.emplace_back("amap -m -Q 0.1 -F 20 -A 20 -C 5000");
+      commands.emplace_back("choice2");
+      commands.emplace_back("amap -m -Q 0.1 -F 20 -A 20 -C 5000");
       break;
     }
     case Mode::AREA_1:
     default: {
-      script << "choice2" << std::endl;
-      script << "amap -m -Q 0.1 -F 20 -A 20 -C 5000" << std::endl;
+      commands.emplace_back("choice2");
+      commands.emplace_back("amap -m -Q 0.1 -F 20 -A 20 -C 5000");
       break;
     }
   }
+  return commands;
+}
+
+void Restructure::setAbcInMemory(bool in_memory)
+{
+  abc_in_memory_ = in_memory;
 }
 
 void Restructure::setMode(const char* mode_name)
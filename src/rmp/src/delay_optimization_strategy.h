@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "abc_library_factory.h"
 #include "base/abc/abc.h"
 #include "db_sta/dbSta.hh"
@@ -12,6 +14,14 @@
 
 namespace rmp {
 
+// Exclusive lock to protect the as of yet static unsafe ABC functions.
+extern std::mutex abc_library_mutex;
+
+// Buffers a mapped logic network using the library's average slew.
+utl::UniquePtrWithDeleter<abc::Abc_Ntk_t> BufferNetwork(
+    abc::Abc_Ntk_t* ntk,
+    AbcLibrary& abc_sc_library);
+
 class DelayOptimizationStrategy : public LogicOptimizationStrategy
 {
  public:
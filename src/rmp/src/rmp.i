@@ -48,9 +48,11 @@ void resynth_cmd(Corner* corner) {
 
 void
 restructure_cmd(char* liberty_file_name, char* target, float slack_threshold,
-                int depth_threshold, char* workdir_name, char* abc_logfile)
+                int depth_threshold, char* workdir_name, char* abc_logfile,
+                bool abc_in_memory)
 {
   getRestructure()->setMode(target);
+  getRestructure()->setAbcInMemory(abc_in_memory);
   getRestructure()->run(liberty_file_name, slack_threshold, depth_threshold,
                         workdir_name, abc_logfile);
 }
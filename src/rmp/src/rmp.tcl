@@ -15,6 +15,8 @@
 # tielo_port:      specifies port name of tie high cell in format <cell_name>/<port_name>
 # work_dir:        Name of working directory for temporary files.
 #                  If not provided run directory would be used
+# abc_in_memory:   Pass the extracted logic to ABC in memory instead of
+#                  through BLIF and script files in work_dir.
 #
 # Note that for delay mode slack_threshold and depth_threshold are both considered together.
 # Even if slack_threshold is violated, path may not be considered for re-synthesis unless
@@ -28,14 +30,15 @@ sta::define_cmd_args "restructure" { \
                                       [-liberty_file liberty_file]\
                                       [-tielo_port tielow_port]\
                                       [-tiehi_port tiehigh_port]\
-                                      [-work_dir workdir_name]
+                                      [-work_dir workdir_name]\
+                                      [-abc_in_memory]
                                     }
 
 proc restructure { args } {
   sta::parse_key_args "restructure" args \
     keys {-slack_threshold -depth_threshold -target -liberty_file -abc_logfile\
           -tielo_port -tiehi_port -work_dir} \
-    flags {}
+    flags {-abc_in_memory}
 
   set slack_threshold_value 0
   set depth_threshold_value 16
@@ -102,7 +105,8 @@ proc restructure { args } {
   }
 
   rmp::restructure_cmd $liberty_file_name $target $slack_threshold_value \
-    $depth_threshold_value $workdir_name $abc_logfile
+    $depth_threshold_value $workdir_name $abc_logfile \
+    [info exists flags(-abc_in_memory)]
 }
 
 sta::define_cmd_args "resynth" {[-corner corner]}
@@ -0,0 +1,51 @@
+# The in-memory ABC flow gives a netlist close to the file based flow
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+
+set tiehi "LOGIC1_X1/Z"
+set tielo "LOGIC0_X1/Z"
+ord::set_thread_count "3"
+
+proc restructure_gcd { args } {
+  read_def gcd_placed.def
+  read_sdc gcd.sdc
+  set_wire_rc -layer metal3
+  estimate_parasitics -placement
+  restructure -liberty_file Nangate45/Nangate45_typ.lib -target area \
+    -tielo_port $::tielo -tiehi_port $::tiehi -work_dir ./results {*}$args
+}
+
+# The flows extract the logic and build the library differently, so the
+# netlists are only compared by instance count and cell area.
+proc netlist_size { } {
+  set block [ord::get_db_block]
+  set area 0
+  foreach inst [$block getInsts] {
+    set master [$inst getMaster]
+    set area [expr { $area + [$master getWidth] * [$master getHeight] }]
+  }
+  return [list [llength [$block getInsts]] $area]
+}
+
+proc within { value reference tolerance } {
+  return [expr { abs($value - $reference) <= $tolerance * $reference }]
+}
+
+restructure_gcd
+lassign [netlist_size] file_insts file_area
+
+odb::dbChip_destroy [odb::dbDatabase_getChip [ord::get_db]]
+
+restructure_gcd -abc_in_memory
+lassign [netlist_size] memory_insts memory_area
+
+if { ![within $memory_insts $file_insts 0.05]
+     || ![within $memory_area $file_area 0.05] } {
+  puts "fail: file based $file_insts instances, area $file_area"
+  puts "fail: in memory $memory_insts instances, area $memory_area"
+  exit 1
+}
+
+puts "pass"
+exit
@@ -24,6 +24,8 @@ class IncrementalGRoute;
 
 namespace stt {
 class SteinerTreeBuilder;
+struct NetPins;
+struct Tree;
 }
 
 namespace sta {
@@ -135,6 +137,14 @@ enum class ParasiticsSrc
   detailed_routing
 };
 
+// How estimateWireParasitic makes the parasitics of a net.
+enum class WireEstimate
+{
+  none,
+  pad,
+  steiner
+};
+
 struct ParasiticsResistance
 {
   double h_res;
@@ -387,6 +397,10 @@ class Resizer : public dbStaState, public dbNetworkObserver
   // resizeSlackPreamble must be called before the first findResizeSlacks.
   void resizeSlackPreamble();
   void findResizeSlacks(bool run_journal_restore);
+  // Lightweight flavor of findResizeSlacks without repair design.  Only the
+  // parasitics of nets are re-estimated, the rest are kept from the previous
+  // pass, and the slacks are updated incrementally.
+  void findResizeSlacksIncremental(const std::vector<dbNet*>& nets);
   // Return nets with worst slack.
   NetSeq& resizeWorstSlackNets();
   // Return net slack, if any (indicated by the bool).
@@ -614,6 +628,12 @@ class Resizer : public dbStaState, public dbNetworkObserver
   void estimateWireParasiticSteiner(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer);
+  void estimateWireParasiticSteiner(const Net* net,
+                                    SteinerTree* tree,
+                                    SpefWriter* spef_writer);
+  // Driver used to estimate the parasitics of net, nullptr if none.
+  const Pin* estimateDriver(const Net* net);
+  WireEstimate wireEstimate(const Pin* drvr_pin, const Net* net);
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -655,6 +675,11 @@ class Resizer : public dbStaState, public dbNetworkObserver
                               bool revisiting_inst);
   // Returns nullptr if net has less than 2 pins or any pin is not placed.
   SteinerTree* makeSteinerTree(const Pin* drvr_pin);
+  // makeSteinerTree split around the flute call so the trees of many nets
+  // can be built with one SteinerTreeBuilder::makeSteinerTrees call.
+  // initSteinerTree returns nullptr under the same conditions.
+  SteinerTree* initSteinerTree(const Pin* drvr_pin, stt::NetPins& net_pins);
+  void finishSteinerTree(SteinerTree* tree, const stt::Tree& ftree);
   BufferedNetPtr makeBufferedNet(const Pin* drvr_pin, const Corner* corner);
   BufferedNetPtr makeBufferedNetSteiner(const Pin* drvr_pin,
                                         const Corner* corner);
@@ -3,8 +3,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "SteinerTree.hh"
 #include "db_sta/SpefWriter.hh"
@@ -18,7 +21,9 @@
 #include "sta/Report.hh"
 #include "sta/Sdc.hh"
 #include "sta/Units.hh"
+#include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
+#include "utl/tracer.h"
 
 namespace rsz {
 
@@ -252,6 +257,7 @@ void Resizer::estimateParasitics(ParasiticsSrc src)
 void Resizer::estimateParasitics(ParasiticsSrc src,
                                  std::map<Corner*, std::ostream*>& spef_streams)
 {
+  utl::TraceZone zone("RSZ:estimateParasitics", "rsz");
   std::unique_ptr<SpefWriter> spef_writer;
   if (!spef_streams.empty()) {
     spef_writer = std::make_unique<SpefWriter>(logger_, sta_, spef_streams);
@@ -411,10 +417,61 @@ void Resizer::estimateWireParasitics(SpefWriter* spef_writer)
     // Note that in hierarchy mode, this will not present all the nets,
     // which is intent here. So get all flat nets from block
     //
+    // The Steiner trees of a batch of nets are built in parallel. The
+    // parasitics are then made, reduced and written in net order because
+    // the parasitics database and spef writer are not thread safe.
+    constexpr size_t batch_size = 10000;
+    const int thread_count = sta_->threadCount();
+    std::vector<const Net*> batch_nets;
+    // nullptr for pad nets and nets without a tree.
+    std::vector<std::unique_ptr<SteinerTree>> batch_trees;
+    std::vector<stt::NetPins> batch_pins;
     odb::dbSet<odb::dbNet> nets = block_->getNets();
-    for (auto db_net : nets) {
-      Net* cur_net = db_network_->dbToSta(db_net);
-      estimateWireParasitic(cur_net, spef_writer);
+    auto db_net_iter = nets.begin();
+    while (db_net_iter != nets.end()) {
+      batch_nets.clear();
+      batch_trees.clear();
+      batch_pins.clear();
+      for (; db_net_iter != nets.end() && batch_nets.size() < batch_size;
+           ++db_net_iter) {
+        const Net* cur_net = db_network_->dbToSta(*db_net_iter);
+        const Pin* drvr_pin = estimateDriver(cur_net);
+        if (drvr_pin == nullptr) {
+          continue;
+        }
+        std::unique_ptr<SteinerTree> tree;
+        switch (wireEstimate(drvr_pin, cur_net)) {
+          case WireEstimate::none:
+            continue;
+          case WireEstimate::pad:
+            break;
+          case WireEstimate::steiner: {
+            stt::NetPins net_pins;
+            tree.reset(initSteinerTree(drvr_pin, net_pins));
+            if (tree == nullptr) {
+              continue;
+            }
+            batch_pins.push_back(std::move(net_pins));
+            break;
+          }
+        }
+        batch_nets.push_back(cur_net);
+        batch_trees.push_back(std::move(tree));
+      }
+
+      std::vector<stt::Tree> ftrees
+          = stt_builder_->makeSteinerTrees(batch_pins, thread_count);
+      int ftree_index = 0;
+      for (int i = 0; i < batch_nets.size(); i++) {
+        const Net* cur_net = batch_nets[i];
+        SteinerTree* tree = batch_trees[i].get();
+        if (tree) {
+          finishSteinerTree(tree, ftrees[ftree_index++]);
+          estimateWireParasiticSteiner(cur_net, tree, spef_writer);
+        } else {
+          makePadParasitic(cur_net, spef_writer);
+        }
+      }
     }
     parasitics_src_ = ParasiticsSrc::placement;
     parasitics_invalid_.clear();
@@ -423,10 +480,8 @@ void Resizer::estimateWireParasitics(SpefWriter* spef_writer)
 
 void Resizer::estimateWireParasitic(const Net* net, SpefWriter* spef_writer)
 {
-  PinSet* drivers = network_->drivers(net);
-  if (drivers && !drivers->empty()) {
-    PinSet::Iterator drvr_iter(drivers);
-    const Pin* drvr_pin = drvr_iter.next();
+  const Pin* drvr_pin = estimateDriver(net);
+  if (drvr_pin) {
     estimateWireParasitic(drvr_pin, net, spef_writer);
   }
 }
@@ -435,18 +490,42 @@ void Resizer::estimateWireParasitic(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer)
 {
-  if (!network_->isPower(net) && !network_->isGround(net)
-      && !sta_->isIdealClock(drvr_pin)
-      && !db_network_->staToDb(net)->isSpecial()) {
-    if (isPadNet(net)) {
-      // When an input port drives a pad instance with huge input
-      // cap the elmore delay is gigantic. Annotate with zero
-      // wire capacitance to prevent wireload model parasitics from being used.
+  switch (wireEstimate(drvr_pin, net)) {
+    case WireEstimate::none:
+      break;
+    case WireEstimate::pad:
       makePadParasitic(net, spef_writer);
-    } else {
+      break;
+    case WireEstimate::steiner:
       estimateWireParasiticSteiner(drvr_pin, net, spef_writer);
-    }
+      break;
+  }
+}
+
+const Pin* Resizer::estimateDriver(const Net* net)
+{
+  PinSet* drivers = network_->drivers(net);
+  if (drivers && !drivers->empty()) {
+    PinSet::Iterator drvr_iter(drivers);
+    return drvr_iter.next();
+  }
+  return nullptr;
+}
+
+WireEstimate Resizer::wireEstimate(const Pin* drvr_pin, const Net* net)
+{
+  if (network_->isPower(net) || network_->isGround(net)
+      || sta_->isIdealClock(drvr_pin)
+      || db_network_->staToDb(net)->isSpecial()) {
+    return WireEstimate::none;
+  }
+  if (isPadNet(net)) {
+    // When an input port drives a pad instance with huge input
+    // cap the elmore delay is gigantic. Annotate with zero
+    // wire capacitance to prevent wireload model parasitics from being used.
+    return WireEstimate::pad;
   }
+  return WireEstimate::steiner;
 }
 
 bool Resizer::isPadNet(const Net* net) const
@@ -489,89 +568,96 @@ void Resizer::estimateWireParasiticSteiner(const Pin* drvr_pin,
 {
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    debugPrint(logger_,
-               RSZ,
-               "resizer_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (Corner* corner : *sta_->corners()) {
-      const ParasiticAnalysisPt* parasitics_ap
-          = corner->findParasiticAnalysisPt(max_);
-      Parasitic* parasitic
-          = sta_->makeParasiticNetwork(net, false, parasitics_ap);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      int branch_count = tree->branchCount();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        ParasiticNode* n1 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        ParasiticNode* n2 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+    estimateWireParasiticSteiner(net, tree, spef_writer);
+    delete tree;
+  }
+}
+
+void Resizer::estimateWireParasiticSteiner(const Net* net,
+                                           SteinerTree* tree,
+                                           SpefWriter* spef_writer)
+{
+  debugPrint(logger_,
+             RSZ,
+             "resizer_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+  for (Corner* corner : *sta_->corners()) {
+    const ParasiticAnalysisPt* parasitics_ap
+        = corner->findParasiticAnalysisPt(max_);
+    Parasitic* parasitic
+        = sta_->makeParasiticNetwork(net, false, parasitics_ap);
+    bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    int branch_count = tree->branchCount();
+    size_t resistor_id = 1;
+    for (int i = 0; i < branch_count; i++) {
+      Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
         } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     RSZ,
-                     "resizer_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics_->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics_->name(n2));
-          parasitics_->incrCap(n1, cap / 2.0);
-          parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics_->incrCap(n2, cap / 2.0);
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
-        parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      if (spef_writer) {
-        spef_writer->writeNet(corner, net, parasitic);
+      ParasiticNode* n1 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt1, network_);
+      ParasiticNode* n2 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt2, network_);
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap;
+        double res = length * wire_res;
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   RSZ,
+                   "resizer_parasitics",
+                   2,
+                   " pi {} l={} c2={} rpi={} c1={} {}",
+                   parasitics_->name(n1),
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   parasitics_->name(n2));
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
+        parasitics_->incrCap(n2, cap / 2.0);
       }
-      arc_delay_calc_->reduceParasitic(
-          parasitic, net, corner, sta::MinMaxAll::all());
+      parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
+      parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
     }
-    parasitics_->deleteParasiticNetworks(net);
-    delete tree;
+    if (spef_writer) {
+      spef_writer->writeNet(corner, net, parasitic);
+    }
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, sta::MinMaxAll::all());
   }
+  parasitics_->deleteParasiticNetworks(net);
 }
 
 float Resizer::pinCapacitance(const Pin* pin,
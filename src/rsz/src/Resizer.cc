@@ -52,6 +52,7 @@
 #include "sta/Units.hh"
 #include "utl/Logger.h"
 #include "utl/scope.h"
+#include "utl/tracer.h"
 
 // http://vlsicad.eecs.umich.edu/BK/Slots/cache/dropzone.tamu.edu/~zhuoli/GSRC/fast_buffer_insertion.html
 
@@ -2065,6 +2066,20 @@ void Resizer::findResizeSlacks(bool run_journal_restore)
     journalRestore();
 }
 
+void Resizer::findResizeSlacksIncremental(const vector<dbNet*>& nets)
+{
+  if (!haveEstimatedParasitics()) {
+    estimateWireParasitics();
+  } else {
+    for (dbNet* net : nets) {
+      parasiticsInvalid(net);
+    }
+    updateParasitics();
+  }
+  // The slacks are found incrementally from the invalidated delays.
+  findResizeSlacks1();
+}
+
 void Resizer::findResizeSlacks1()
 {
   // Use driver pin slacks rather than Sta::netSlack to save visiting
@@ -3552,6 +3567,7 @@ void Resizer::repairDesign(double max_wire_length,
                            bool match_cell_footprint,
                            bool verbose)
 {
+  utl::TraceZone zone("RSZ:repairDesign", "rsz");
   utl::SetAndRestore set_match_footprint(match_cell_footprint_,
                                          match_cell_footprint);
   resizePreamble();
@@ -3579,6 +3595,7 @@ void Resizer::repairNet(Net* net,
 
 void Resizer::repairClkNets(double max_wire_length)
 {
+  utl::TraceZone zone("RSZ:repairClkNets", "rsz");
   resizePreamble();
   utl::SetAndRestore set_buffers(buffer_cells_, clk_buffers_);
 
@@ -3708,6 +3725,7 @@ bool Resizer::repairSetup(double setup_margin,
                           bool skip_buffer_removal,
                           bool skip_last_gasp)
 {
+  utl::TraceZone zone("RSZ:repairSetup", "rsz");
   utl::SetAndRestore set_match_footprint(match_cell_footprint_,
                                          match_cell_footprint);
   resizePreamble();
@@ -3758,6 +3776,7 @@ bool Resizer::repairHold(
     bool match_cell_footprint,
     bool verbose)
 {
+  utl::TraceZone zone("RSZ:repairHold", "rsz");
   utl::SetAndRestore set_match_footprint(match_cell_footprint_,
                                          match_cell_footprint);
   // Some technologies such as nangate45 don't have delay cells. Hence,
@@ -34,6 +34,20 @@ static void connectedPins(const Net* net,
 
 // Returns nullptr if net has less than 2 pins or any pin is not placed.
 SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
+{
+  stt::NetPins net_pins;
+  SteinerTree* tree = initSteinerTree(drvr_pin, net_pins);
+  if (tree) {
+    stt::Tree ftree = stt_builder_->makeSteinerTree(
+        net_pins.net, net_pins.x, net_pins.y, net_pins.drvr_index);
+    finishSteinerTree(tree, ftree);
+  }
+  return tree;
+}
+
+// Collects the pin locations of the net into tree and net_pins.
+SteinerTree* Resizer::initSteinerTree(const Pin* drvr_pin,
+                                      stt::NetPins& net_pins)
 {
   Network* sdc_network = network_->sdcNetwork();
 
@@ -62,13 +76,17 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
   int pin_count = pinlocs.size();
   bool is_placed = true;
   if (pin_count >= 2) {
-    std::vector<int> x;  // Two separate vectors of coordinates needed by flute.
-    std::vector<int> y;
-    int drvr_idx = 0;  // The "driver_pin" or the root of the Steiner tree.
+    // Two separate vectors of coordinates needed by flute.
+    std::vector<int>& x = net_pins.x;
+    std::vector<int>& y = net_pins.y;
+    x.clear();
+    y.clear();
+    // The "driver_pin" or the root of the Steiner tree.
+    net_pins.drvr_index = 0;
     for (int i = 0; i < pin_count; i++) {
       const PinLoc& pinloc = pinlocs[i];
       if (pinloc.pin == drvr_pin) {
-        drvr_idx = i;  // drvr_index is needed by flute.
+        net_pins.drvr_index = i;  // drvr_index is needed by flute.
       }
       x.push_back(pinloc.loc.x());
       y.push_back(pinloc.loc.y());
@@ -89,11 +107,7 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
       tree->locAddPin(pinloc.loc, pinloc.pin);
     }
     if (is_placed) {
-      stt::Tree ftree = stt_builder_->makeSteinerTree(
-          db_network_->staToDb(net), x, y, drvr_idx);
-
-      tree->setTree(ftree, db_network_);
-      tree->createSteinerPtToPinMap();
+      net_pins.net = db_network_->staToDb(net);
       return tree;
     }
   }
@@ -101,6 +115,12 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
   return nullptr;
 }
 
+void Resizer::finishSteinerTree(SteinerTree* tree, const stt::Tree& ftree)
+{
+  tree->setTree(ftree, db_network_);
+  tree->createSteinerPtToPinMap();
+}
+
 static void connectedPins(const Net* net,
                           Network* network,
                           dbNetwork* db_network,
@@ -0,0 +1,66 @@
+# 2 corners, batched placement parasitics match the per net estimates
+source "helpers.tcl"
+define_corners ss ff
+read_liberty -corner ss Nangate45/Nangate45_slow.lib
+read_liberty -corner ff Nangate45/Nangate45_fast.lib
+read_lef Nangate45/Nangate45.lef
+read_def gcd_nangate45_placed.def
+
+create_clock -period 10 clk
+
+# kohm/micron
+set r 5.43e-3
+# fF/micron
+set c 6.013e-2
+
+set_wire_rc -corner ff -resistance [expr $r * 0.8] -capacitance [expr $c * 0.8]
+set_wire_rc -corner ss -resistance [expr $r * 1.2] -capacitance [expr $c * 1.2]
+
+proc report_all_nets { } {
+  foreach net [get_nets *] {
+    foreach corner {ss ff} {
+      report_net -corner $corner [get_full_name $net]
+    }
+  }
+}
+
+proc read_file { file } {
+  set stream [open $file r]
+  set contents [read $stream]
+  close $stream
+  return $contents
+}
+
+# The spef is the same whether the trees are built serially or in parallel.
+set spef1 [make_result_file make_parasitics8_1.spef]
+set spef4 [make_result_file make_parasitics8_4.spef]
+set_thread_count 1
+estimate_parasitics -placement -spef_file $spef1
+set_thread_count 4
+estimate_parasitics -placement -spef_file $spef4
+with_output_to_variable batch_nets { report_all_nets }
+
+set pass 1
+foreach corner {ss ff} {
+  set file1 [file rootname $spef1]_$corner.spef
+  set file4 [file rootname $spef4]_$corner.spef
+  set contents1 [read_file $file1]
+  if { $contents1 eq "" || $contents1 ne [read_file $file4] } {
+    puts "spef for corner $corner differs"
+    set pass 0
+  }
+}
+
+# Rebuild every net through the single net path.
+foreach net [get_nets *] {
+  rsz::estimate_parasitic_net $net
+}
+with_output_to_variable single_nets { report_all_nets }
+if { $batch_nets ne $single_nets } {
+  puts "batch and single net parasitics differ"
+  set pass 0
+}
+
+if { $pass } {
+  puts "pass"
+}
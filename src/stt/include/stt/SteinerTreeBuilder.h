@@ -48,6 +48,16 @@ struct Tree
   int branchCount() const { return branch.size(); }
 };
 
+// The pins of one net for the batch API.
+struct NetPins
+{
+  std::vector<int> x;
+  std::vector<int> y;
+  int drvr_index = 0;
+  // Selects the net's alpha when set.
+  odb::dbNet* net = nullptr;
+};
+
 class SteinerTreeBuilder
 {
  public:
@@ -74,6 +84,18 @@ class SteinerTreeBuilder
                        const std::vector<int>& s,
                        int acc);
 
+  // Batch versions of the above that build the trees of many nets on up to
+  // num_threads threads.  Tree i is the same as building net i alone.  The
+  // alphas must not be changed while they run.
+  std::vector<Tree> makeSteinerTrees(const std::vector<NetPins>& nets,
+                                     int num_threads);
+  std::vector<Tree> makeSteinerTrees(
+      const std::vector<std::vector<int>>& xs,
+      const std::vector<std::vector<int>>& ys,
+      const std::vector<std::vector<int>>& s,
+      int acc,
+      int num_threads);
+
   bool checkTree(const Tree& tree) const;
   float getAlpha() const { return alpha_; }
   void setAlpha(float alpha);
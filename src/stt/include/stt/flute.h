@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2019-2025, The OpenROAD Authors
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #include "SteinerTreeBuilder.h"
@@ -41,6 +43,9 @@ class Flute
 
   // User-Callable Functions
   // Delete LUT tables for exit so they are not leaked.
+  // The functions below may be called from several threads at once.  The
+  // LUTs are loaded under a lock and only read after that, all other state
+  // is local to the call.
 
   Tree flute(const std::vector<int>& x, const std::vector<int>& y, int acc);
   int wirelength(Tree t);
@@ -60,7 +65,7 @@ class Flute
  private:
   void readLUT();
   void makeLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln);
-  void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln);
+  void initLUT(int from_d, int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln);
   void ensureLUT(int d);
   void deleteLUT();
   void deleteLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln);
@@ -168,7 +173,8 @@ class Flute
   NUMSOLN_TYPE numsoln = nullptr;
   // LUTs are initialized to this order at startup.
   const int lut_initial_d = 8;
-  int lut_valid_d = 0;
+  std::atomic<int> lut_valid_d{0};
+  std::mutex lut_mutex_;
 
   const int numgrp[10] = {0, 0, 0, 0, 6, 30, 180, 1260, 10080, 90720};
 };
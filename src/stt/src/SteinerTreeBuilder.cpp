@@ -14,6 +14,7 @@
 #include "odb/db.h"
 #include "stt/flute.h"
 #include "stt/pd.h"
+#include "utl/exception.h"
 
 namespace stt {
 
@@ -55,8 +56,10 @@ Tree SteinerTreeBuilder::makeSteinerTree(odb::dbNet* net,
   int min_fanout = min_fanout_alpha_.first;
   int min_hpwl = min_hpwl_alpha_.first;
 
-  if (net_alpha_map_.find(net) != net_alpha_map_.end()) {
-    net_alpha = net_alpha_map_[net];
+  // Only read net_alpha_map_ as this may run on several threads
+  auto net_alpha_it = net_alpha_map_.find(net);
+  if (net_alpha_it != net_alpha_map_.end()) {
+    net_alpha = net_alpha_it->second;
   } else if (min_hpwl > 0) {
     if (computeHPWL(net) >= min_hpwl) {
       net_alpha = min_hpwl_alpha_.second;
@@ -93,6 +96,53 @@ Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
   return flute_->flutes(x, y, s, accuracy);
 }
 
+std::vector<Tree> SteinerTreeBuilder::makeSteinerTrees(
+    const std::vector<NetPins>& nets,
+    const int num_threads)
+{
+  std::vector<Tree> trees(nets.size());
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+  for (int i = 0; i < nets.size(); i++) {
+    try {
+      const NetPins& pins = nets[i];
+      if (pins.net != nullptr) {
+        trees[i]
+            = makeSteinerTree(pins.net, pins.x, pins.y, pins.drvr_index);
+      } else {
+        trees[i] = makeSteinerTree(pins.x, pins.y, pins.drvr_index);
+      }
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  return trees;
+}
+
+std::vector<Tree> SteinerTreeBuilder::makeSteinerTrees(
+    const std::vector<std::vector<int>>& xs,
+    const std::vector<std::vector<int>>& ys,
+    const std::vector<std::vector<int>>& s,
+    const int acc,
+    const int num_threads)
+{
+  std::vector<Tree> trees(xs.size());
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+  for (int i = 0; i < xs.size(); i++) {
+    try {
+      trees[i] = flute_->flutes(xs[i], ys[i], s[i], acc);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  return trees;
+}
+
 static bool rectAreaZero(const odb::Rect& rect)
 {
   return rect.xMin() == rect.xMax() && rect.yMin() == rect.yMax();
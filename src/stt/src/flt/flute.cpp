@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -179,7 +180,7 @@ void Flute::readLUT()
 
 #elif LUT_SOURCE == LUT_VAR
   // Only init to d=8 on startup because d=9 is big and slow.
-  initLUT(lut_initial_d, LUT, numsoln);
+  initLUT(4, lut_initial_d, LUT, numsoln);
 
 #elif LUT_SOURCE == LUT_VAR_CHECK
   readLUTfiles(LUT, numsoln);
@@ -187,7 +188,7 @@ void Flute::readLUT()
   LUT_TYPE LUT_;
   NUMSOLN_TYPE numsoln_;
   makeLUT(LUT_, numsoln_);
-  initLUT(FLUTE_D, LUT_, numsoln_);
+  initLUT(4, FLUTE_D, LUT_, numsoln_);
   checkLUT(LUT, numsoln, LUT_, numsoln_);
 #endif
 }
@@ -249,8 +250,9 @@ inline const char* readDecimalInt(const char* s, int& value)
   return s;
 }
 
-// Init LUTs from base64 encoded string variables.
-void Flute::initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
+// Init LUTs from base64 encoded string variables.  Degrees below from_d
+// are parsed but left as they are, as other threads may be reading them.
+void Flute::initLUT(int from_d, int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 {
   std::string pwv_string = utl::base64_decode(powv9);
   const char* pwv = pwv_string.c_str();
@@ -271,18 +273,25 @@ void Flute::initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
     }
     ++prt;
 #endif
+    const bool store = d >= from_d;
     for (int k = 0; k < numgrp[d]; k++) {
       int ns = charNum(*pwv++);
       if (ns == 0) {  // same as some previous group
         int kk;
         pwv = readDecimalInt(pwv, kk) + 1;
-        numsoln[d][k] = numsoln[d][kk];
-        LUT[d][k] = LUT[d][kk];
+        if (store) {
+          numsoln[d][k] = numsoln[d][kk];
+          LUT[d][k] = LUT[d][kk];
+        }
       } else {
         pwv++;  // '\n'
-        numsoln[d][k] = ns;
-        struct csoln* p = new struct csoln[ns];
-        LUT[d][k] = p;
+        struct csoln skipped;
+        struct csoln* p = &skipped;
+        if (store) {
+          numsoln[d][k] = ns;
+          p = new struct csoln[ns];
+          LUT[d][k] = p;
+        }
         for (int i = 1; i <= ns; i++) {
           p->parent = charNum(*pwv++);
 
@@ -318,7 +327,9 @@ void Flute::initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
           }
           prt++;  // \n
 #endif
-          p++;
+          if (store) {
+            p++;
+          }
         }
       }
     }
@@ -328,11 +339,17 @@ void Flute::initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 
 void Flute::ensureLUT(int d)
 {
+  // Larger degrees are split up and only need the LUTs to be loaded
+  const int lut_d = d <= FLUTE_D ? d : lut_initial_d;
+  if (lut_d <= lut_valid_d) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex_);
   if (LUT == nullptr) {
     readLUT();
   }
-  if (d > lut_valid_d && d <= FLUTE_D) {
-    initLUT(FLUTE_D, LUT, numsoln);
+  if (lut_d > lut_valid_d) {
+    initLUT(lut_valid_d + 1, FLUTE_D, LUT, numsoln);
   }
 }
 
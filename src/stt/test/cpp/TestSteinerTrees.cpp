@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stt/SteinerTreeBuilder.h"
+#include "utl/Logger.h"
+
+namespace stt {
+namespace {
+
+constexpr int num_threads = 4;
+
+// Nets of 2 to 60 pins so both the LUT and the net breaking paths of flute
+// are used.
+std::vector<NetPins> makeNets(const int count)
+{
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> degree(2, 60);
+  std::uniform_int_distribution<int> coord(0, 100000);
+  std::vector<NetPins> nets(count);
+  for (NetPins& net : nets) {
+    const int pins = degree(rng);
+    for (int i = 0; i < pins; i++) {
+      net.x.push_back(coord(rng));
+      net.y.push_back(coord(rng));
+    }
+    net.drvr_index = std::uniform_int_distribution<int>(0, pins - 1)(rng);
+  }
+  return nets;
+}
+
+void expectSameTree(const Tree& batch, const Tree& single)
+{
+  EXPECT_EQ(batch.deg, single.deg);
+  EXPECT_EQ(batch.length, single.length);
+  ASSERT_EQ(batch.branch.size(), single.branch.size());
+  for (std::size_t i = 0; i < batch.branch.size(); i++) {
+    EXPECT_EQ(batch.branch[i].x, single.branch[i].x);
+    EXPECT_EQ(batch.branch[i].y, single.branch[i].y);
+    EXPECT_EQ(batch.branch[i].n, single.branch[i].n);
+  }
+}
+
+void expectBatchMatchesSingle(const float alpha)
+{
+  utl::Logger logger;
+  SteinerTreeBuilder builder;
+  builder.init(nullptr, &logger);
+  builder.setAlpha(alpha);
+
+  const std::vector<NetPins> nets = makeNets(500);
+  const std::vector<Tree> trees = builder.makeSteinerTrees(nets, num_threads);
+  ASSERT_EQ(trees.size(), nets.size());
+  for (std::size_t i = 0; i < nets.size(); i++) {
+    const Tree single
+        = builder.makeSteinerTree(nets[i].x, nets[i].y, nets[i].drvr_index);
+    EXPECT_GT(trees[i].length, 0);
+    expectSameTree(trees[i], single);
+  }
+}
+
+TEST(SteinerTreesTest, BatchMatchesSingleFlute)
+{
+  expectBatchMatchesSingle(0.0);
+}
+
+TEST(SteinerTreesTest, BatchMatchesSinglePD)
+{
+  expectBatchMatchesSingle(0.3);
+}
+
+TEST(SteinerTreesTest, BatchMatchesSingleFlutes)
+{
+  utl::Logger logger;
+  SteinerTreeBuilder builder;
+  builder.init(nullptr, &logger);
+
+  // The FastRoute form takes the pins sorted by x, the y values sorted and
+  // s[i] the x order of the pin with the i-th smallest y.
+  const std::vector<NetPins> nets = makeNets(500);
+  std::vector<std::vector<int>> xs, ys, s;
+  for (const NetPins& net : nets) {
+    const int pins = net.x.size();
+    std::vector<int> by_x(pins);
+    std::iota(by_x.begin(), by_x.end(), 0);
+    std::stable_sort(by_x.begin(), by_x.end(), [&net](int a, int b) {
+      return net.x[a] < net.x[b];
+    });
+    std::vector<int> x_order(pins);
+    std::vector<int> sorted_x(pins);
+    for (int i = 0; i < pins; i++) {
+      x_order[by_x[i]] = i;
+      sorted_x[i] = net.x[by_x[i]];
+    }
+    std::vector<int> by_y(pins);
+    std::iota(by_y.begin(), by_y.end(), 0);
+    std::stable_sort(by_y.begin(), by_y.end(), [&net](int a, int b) {
+      return net.y[a] < net.y[b];
+    });
+    std::vector<int> sorted_y(pins);
+    std::vector<int> sorted_s(pins);
+    for (int i = 0; i < pins; i++) {
+      sorted_y[i] = net.y[by_y[i]];
+      sorted_s[i] = x_order[by_y[i]];
+    }
+    xs.push_back(sorted_x);
+    ys.push_back(sorted_y);
+    s.push_back(sorted_s);
+  }
+
+  constexpr int acc = 3;
+  const std::vector<Tree> trees
+      = builder.makeSteinerTrees(xs, ys, s, acc, num_threads);
+  ASSERT_EQ(trees.size(), nets.size());
+  for (std::size_t i = 0; i < nets.size(); i++) {
+    const Tree single = builder.makeSteinerTree(xs[i], ys[i], s[i], acc);
+    EXPECT_GT(trees[i].length, 0);
+    expectSameTree(trees[i], single);
+  }
+}
+
+}  // namespace
+}  // namespace stt
@@ -31,6 +31,7 @@ namespace utl {
 
 class PrometheusMetricsServer;
 class PrometheusRegistry;
+class ProcessMetrics;
 
 class Progress;
 
@@ -337,6 +338,7 @@ class Logger
 
   // Prometheus server metrics collection
   std::shared_ptr<PrometheusRegistry> prometheus_registry_;
+  std::unique_ptr<ProcessMetrics> process_metrics_;
   std::unique_ptr<PrometheusMetricsServer> prometheus_metrics_;
 
   // This matrix is pre-allocated so it can be safely updated
@@ -9,10 +9,12 @@
 #include <atomic>
 #include <chrono>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <utility>
 
 #include "registry.h"
 #include "text_serializer.h"
@@ -25,13 +27,16 @@ namespace utl {
 class PrometheusMetricsServer
 {
  public:
+  // on_scrape is called on the server thread before each collection.
   PrometheusMetricsServer(std::shared_ptr<PrometheusRegistry>& registry_,
                           utl::Logger* logger,
-                          uint16_t port)
+                          uint16_t port,
+                          std::function<void()> on_scrape = {})
   {
     SetRegistry(registry_);
     port_ = port;
     logger_ = logger;
+    on_scrape_ = std::move(on_scrape);
     worker_thread_
         = std::thread(&PrometheusMetricsServer::WorkerFunction, this);
   }
@@ -50,6 +55,7 @@ class PrometheusMetricsServer
   std::shared_ptr<PrometheusRegistry> registry_ptr_{nullptr};
   uint16_t port_;
   std::atomic<utl::Logger*> logger_;
+  std::function<void()> on_scrape_;
   bool shutdown_ = false;
   bool is_ready_ = false;
 
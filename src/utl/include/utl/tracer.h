@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace utl {
+class Logger;
+
+// A lightweight tracing profiler.  Code marks its phases with TraceZone
+// objects; while tracing is enabled each zone records its start time,
+// duration, thread and nesting depth into a ring buffer owned by the
+// recording thread, so recording never takes a lock.  The collected zones
+// can be written as a Chrome trace (chrome://tracing, ui.perfetto.dev).
+//
+// Zone names and categories must be string literals (or otherwise outlive
+// the trace) as only the pointers are recorded; names built at runtime can
+// be made to last with intern().
+//
+// Each thread that records a zone while tracing allocates a buffer of
+// kBufferSize events (about 2.5MB) on its first zone.  The buffers are kept
+// until exit and are reused by threads started later, so the memory grows
+// with the peak number of threads recording at the same time.
+class Tracer
+{
+ public:
+  struct Event
+  {
+    const char* name;
+    const char* category;
+    int64_t start_ns;
+    int64_t duration_ns;
+    int depth;
+    int tid;
+  };
+  struct ThreadTrace
+  {
+    int tid;
+    std::vector<Event> events;
+  };
+
+  static Tracer& get();
+
+  // Starts a new trace.  Events of the previous trace, including zones that
+  // were still open, are dropped.
+  void start();
+  void stop();
+  static bool isEnabled()
+  {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  // Returns a copy of name that lives as long as the tracer.
+  const char* intern(const std::string& name);
+
+  // Writes the Chrome trace JSON and returns the number of zones written.
+  // Tracing should be stopped first.
+  std::size_t writeChromeTrace(std::ostream& out);
+  void writeChromeTrace(const std::string& filename, Logger* logger);
+
+  // Zones recorded so far in the current trace, per thread in the order
+  // they ended.
+  std::vector<ThreadTrace> getTraces();
+
+ private:
+  // Events kept per thread; the oldest are overwritten once full.
+  static constexpr std::size_t kBufferSize = 1 << 16;
+
+  using Clock = std::chrono::steady_clock;
+
+  // Single producer ring buffer.  Only the owning thread writes events and
+  // head; it publishes events by advancing head and rewinds the buffer
+  // itself when it first records in a new trace.
+  struct ThreadBuffer
+  {
+    explicit ThreadBuffer(int tid) : tid(tid), events(kBufferSize) {}
+    // Id of the owning thread; a reused buffer gets a new one.
+    int tid;
+    std::vector<Event> events;
+    std::atomic<uint64_t> head{0};
+    // Trace the events in the buffer belong to.
+    std::atomic<uint64_t> trace{0};
+    int depth = 0;
+    std::atomic<bool> in_use{true};
+  };
+
+  // Returns the buffer to the pool when its thread exits.
+  struct BufferHandle
+  {
+    ThreadBuffer* buffer = nullptr;
+    ~BufferHandle();
+  };
+
+  Tracer() = default;
+
+  int64_t now() const;
+  ThreadBuffer* threadBuffer();
+  ThreadBuffer* acquireBuffer();
+  void record(ThreadBuffer* buffer,
+              const char* name,
+              const char* category,
+              uint64_t trace,
+              int64_t start_ns,
+              int depth);
+
+  static std::atomic<bool> enabled_;
+
+  std::mutex buffers_mutex_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+  int next_tid_ = 1;
+  // Incremented by every start(); zones only record into the trace they
+  // began in.
+  std::atomic<uint64_t> trace_{0};
+  std::atomic<int64_t> epoch_ns_{0};
+  std::mutex names_mutex_;
+  std::unordered_set<std::string> names_;
+
+  friend class TraceZone;
+};
+
+// Records the enclosing scope as a zone when tracing is enabled.  When it
+// is not the cost is a single relaxed atomic load.
+class TraceZone
+{
+ public:
+  TraceZone(const char* name, const char* category = "")
+  {
+    if (Tracer::isEnabled()) {
+      begin(name, category);
+    }
+  }
+  ~TraceZone()
+  {
+    if (buffer_) {
+      end();
+    }
+  }
+  // Ends the zone before the end of its scope.
+  void done()
+  {
+    if (buffer_) {
+      end();
+    }
+  }
+
+  TraceZone(const TraceZone&) = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+
+ private:
+  void begin(const char* name, const char* category);
+  void end();
+
+  Tracer::ThreadBuffer* buffer_ = nullptr;
+  const char* name_ = nullptr;
+  const char* category_ = nullptr;
+  uint64_t trace_ = 0;
+  int64_t start_ns_ = 0;
+  int depth_ = 0;
+};
+
+}  // namespace utl
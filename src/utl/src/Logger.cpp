@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "CommandLineProgress.h"
+#include "ProcessMetrics.h"
 #if SPDLOG_VERSION < 10601
 #include "spdlog/details/pattern_formatter.h"
 #else
@@ -52,6 +53,7 @@ Logger::Logger(const char* log_filename, const char* metrics_filename)
   }
 
   prometheus_registry_ = std::make_shared<PrometheusRegistry>();
+  process_metrics_ = std::make_unique<ProcessMetrics>(*prometheus_registry_);
 }
 
 Logger::~Logger()
@@ -132,17 +134,20 @@ void Logger::setMetricsStage(std::string_view format)
     metrics_stages_.push(std::string(format));
   else
     metrics_stages_.top() = format;
+  process_metrics_->setStage(metrics_stages_.top());
 }
 
 void Logger::clearMetricsStage()
 {
   std::stack<std::string> new_stack;
   metrics_stages_.swap(new_stack);
+  process_metrics_->setStage("");
 }
 
 void Logger::pushMetricsStage(std::string_view format)
 {
   metrics_stages_.push(std::string(format));
+  process_metrics_->setStage(metrics_stages_.top());
 }
 
 std::string Logger::popMetricsStage()
@@ -150,6 +155,8 @@ std::string Logger::popMetricsStage()
   if (!metrics_stages_.empty()) {
     std::string stage = metrics_stages_.top();
     metrics_stages_.pop();
+    process_metrics_->setStage(
+        metrics_stages_.empty() ? "" : metrics_stages_.top());
     return stage;
   }
   return "";
@@ -310,7 +317,9 @@ void Logger::startPrometheusEndpoint(uint16_t port)
   }
 
   prometheus_metrics_ = std::make_unique<PrometheusMetricsServer>(
-      prometheus_registry_, this, port);
+      prometheus_registry_, this, port, [this] {
+        process_metrics_->update();
+      });
 }
 
 std::shared_ptr<PrometheusRegistry> Logger::getRegistry()
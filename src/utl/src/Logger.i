@@ -4,6 +4,7 @@
 %{
 
 #include "utl/Logger.h"
+#include "utl/tracer.h"
 #include "LoggerCommon.h"
     
 namespace ord {
@@ -101,6 +102,21 @@ void startPrometheusEndpoint(uint16_t port)
   logger->startPrometheusEndpoint(port);
 }
 
+void startTracing()
+{
+  utl::Tracer::get().start();
+}
+
+void stopTracing()
+{
+  utl::Tracer::get().stop();
+}
+
+void writeTrace(const std::string& filename)
+{
+  utl::Tracer::get().writeChromeTrace(filename, ord::getLogger());
+}
+
 } // namespace
 
 %} // inline
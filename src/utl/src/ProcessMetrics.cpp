@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#include "ProcessMetrics.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace utl {
+
+namespace {
+
+Gauge<double>& addGauge(PrometheusRegistry& registry,
+                        const std::string& name,
+                        const std::string& help)
+{
+  return BuildGauge().Name(name).Help(help).Register(registry).Add({});
+}
+
+CustomFamily<Gauge<double>>& addGaugeFamily(PrometheusRegistry& registry,
+                                            const std::string& name,
+                                            const std::string& help)
+{
+  return BuildGauge().Name(name).Help(help).Register(registry);
+}
+
+double currentRSS()
+{
+#if defined(__linux__)
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  if (statm >> size >> resident) {
+    return static_cast<double>(resident) * sysconf(_SC_PAGESIZE);
+  }
+#endif
+  return 0;
+}
+
+double peakRSS()
+{
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(__APPLE__) && defined(__MACH__)
+  return usage.ru_maxrss;
+#else
+  return usage.ru_maxrss * 1024.0;
+#endif
+}
+
+double threadCount()
+{
+#if defined(__linux__)
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 8, "Threads:") == 0) {
+      return std::stod(line.substr(8));
+    }
+  }
+#endif
+  return 0;
+}
+
+// Stage names are metric name formats such as "globalroute__{}".
+std::string stageLabel(const std::string& stage)
+{
+  std::string label = stage;
+  const auto pos = label.find("{}");
+  if (pos != std::string::npos) {
+    label.erase(pos);
+  }
+  while (!label.empty() && label.back() == '_') {
+    label.pop_back();
+  }
+  return label;
+}
+
+}  // namespace
+
+ProcessMetrics::ProcessMetrics(PrometheusRegistry& registry)
+    : rss_(addGauge(registry,
+                    "ord_resident_memory_bytes",
+                    "Resident memory of the process")),
+      peak_rss_(addGauge(registry,
+                         "ord_peak_resident_memory_bytes",
+                         "Peak resident memory of the process")),
+      wall_(addGauge(registry,
+                     "ord_wall_seconds",
+                     "Wall time since the process started")),
+      cpu_(addGauge(registry,
+                    "ord_cpu_seconds",
+                    "User and system CPU time of all threads")),
+      threads_(addGauge(registry, "ord_threads", "Number of threads")),
+      utilization_(addGauge(registry,
+                            "ord_thread_utilization",
+                            "Busy cores averaged since the last scrape")),
+      stage_wall_(addGaugeFamily(registry,
+                                 "ord_stage_wall_seconds",
+                                 "Wall time spent in each metrics stage")),
+      stage_cpu_(addGaugeFamily(registry,
+                                "ord_stage_cpu_seconds",
+                                "CPU time spent in each metrics stage"))
+{
+  start_ = sample();
+  last_update_ = start_;
+}
+
+ProcessMetrics::Sample ProcessMetrics::sample() const
+{
+  Sample now;
+  now.wall = std::chrono::duration<double>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+                 .count();
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    now.cpu = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec
+              + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+  }
+  return now;
+}
+
+void ProcessMetrics::update()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Sample now = sample();
+  rss_.Set(currentRSS());
+  peak_rss_.Set(peakRSS());
+  wall_.Set(now.wall - start_.wall);
+  cpu_.Set(now.cpu - start_.cpu);
+  threads_.Set(threadCount());
+  const double wall_delta = now.wall - last_update_.wall;
+  if (wall_delta > 0) {
+    utilization_.Set((now.cpu - last_update_.cpu) / wall_delta);
+  }
+  last_update_ = now;
+  updateStage(now);
+}
+
+void ProcessMetrics::setStage(const std::string& stage)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Sample now = sample();
+  updateStage(now);
+  stage_ = stageLabel(stage);
+  stage_start_ = now;
+}
+
+// Stages can repeat (e.g. several repair_timing calls), so their times
+// accumulate.
+void ProcessMetrics::updateStage(const Sample& now)
+{
+  if (stage_.empty()) {
+    return;
+  }
+  const Family::Labels labels{{"stage", stage_}};
+  stage_wall_.Add(labels).Increment(now.wall - stage_start_.wall);
+  stage_cpu_.Add(labels).Increment(now.cpu - stage_start_.cpu);
+  stage_start_ = now;
+}
+
+}  // namespace utl
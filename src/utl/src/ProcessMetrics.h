@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include "utl/prometheus/family.h"
+#include "utl/prometheus/gauge.h"
+#include "utl/prometheus/registry.h"
+
+namespace utl {
+
+// Process level gauges published on the Prometheus endpoint: memory, CPU
+// and wall time, thread count and utilization, plus wall and CPU time per
+// metrics stage.  Values are sampled when the endpoint is scraped.
+class ProcessMetrics
+{
+ public:
+  explicit ProcessMetrics(PrometheusRegistry& registry);
+
+  // Refreshes the gauges; called before each scrape.
+  void update();
+  // Ends the timing of the current stage and starts timing stage.  An
+  // empty stage stops stage timing.
+  void setStage(const std::string& stage);
+
+ private:
+  struct Sample
+  {
+    double wall = 0;
+    double cpu = 0;
+  };
+
+  Sample sample() const;
+  void updateStage(const Sample& now);
+
+  std::mutex mutex_;
+  Sample start_;
+  Sample last_update_;
+  Sample stage_start_;
+  std::string stage_;
+
+  Gauge<double>& rss_;
+  Gauge<double>& peak_rss_;
+  Gauge<double>& wall_;
+  Gauge<double>& cpu_;
+  Gauge<double>& threads_;
+  Gauge<double>& utilization_;
+  CustomFamily<Gauge<double>>& stage_wall_;
+  CustomFamily<Gauge<double>>& stage_cpu_;
+};
+
+}  // namespace utl
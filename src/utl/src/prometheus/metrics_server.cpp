@@ -122,6 +122,10 @@ void PrometheusMetricsServer::RunServer()
       continue;  // Skip to the next iteration
     }
 
+    if (on_scrape_ && request.target() == "/metrics") {
+      on_scrape_();
+    }
+
     // Handle the request
     boost::beast::http::response<boost::beast::http::string_body> response
         = HandleRequest(request, socket, registry_ptr_.get());
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#include "utl/tracer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "spdlog/fmt/fmt.h"
+#include "utl/Logger.h"
+
+namespace utl {
+
+std::atomic<bool> Tracer::enabled_{false};
+
+Tracer& Tracer::get()
+{
+  // Never destroyed so that threads exiting during shutdown can still
+  // return their buffers.
+  static Tracer* tracer = new Tracer;
+  return *tracer;
+}
+
+// The buffers are not touched here as their threads may be recording;
+// each thread rewinds its own buffer when it records into the new trace.
+void Tracer::start()
+{
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  epoch_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  Clock::now().time_since_epoch())
+                  .count();
+  trace_.fetch_add(1, std::memory_order_release);
+  enabled_ = true;
+}
+
+void Tracer::stop()
+{
+  enabled_ = false;
+}
+
+int64_t Tracer::now() const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+             .count()
+         - epoch_ns_.load(std::memory_order_relaxed);
+}
+
+const char* Tracer::intern(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(names_mutex_);
+  return names_.insert(name).first->c_str();
+}
+
+Tracer::BufferHandle::~BufferHandle()
+{
+  if (buffer) {
+    buffer->depth = 0;
+    buffer->in_use.store(false, std::memory_order_release);
+  }
+}
+
+Tracer::ThreadBuffer* Tracer::threadBuffer()
+{
+  thread_local BufferHandle handle;
+  if (!handle.buffer) {
+    handle.buffer = acquireBuffer();
+  }
+  return handle.buffer;
+}
+
+// Buffers of exited threads are reused so that short lived worker threads
+// don't each leave a buffer behind.
+Tracer::ThreadBuffer* Tracer::acquireBuffer()
+{
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (auto& buffer : buffers_) {
+    if (!buffer->in_use.load(std::memory_order_acquire)) {
+      buffer->in_use = true;
+      buffer->tid = next_tid_++;
+      return buffer.get();
+    }
+  }
+  buffers_.push_back(std::make_unique<ThreadBuffer>(next_tid_++));
+  return buffers_.back().get();
+}
+
+void Tracer::record(ThreadBuffer* buffer,
+                    const char* name,
+                    const char* category,
+                    uint64_t trace,
+                    int64_t start_ns,
+                    int depth)
+{
+  // Zones still open when tracing was stopped or restarted are dropped.
+  if (!isEnabled() || trace != trace_.load(std::memory_order_acquire)) {
+    return;
+  }
+  if (buffer->trace.load(std::memory_order_relaxed) != trace) {
+    buffer->head.store(0, std::memory_order_relaxed);
+    buffer->trace.store(trace, std::memory_order_release);
+  }
+  const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+  buffer->events[head % kBufferSize]
+      = {name, category, start_ns, now() - start_ns, depth, buffer->tid};
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<Tracer::ThreadTrace> Tracer::getTraces()
+{
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  const uint64_t current = trace_.load(std::memory_order_acquire);
+  // A reused buffer holds the events of several threads.
+  std::map<int, std::vector<Event>> thread_events;
+  for (auto& buffer : buffers_) {
+    if (buffer->trace.load(std::memory_order_acquire) != current) {
+      continue;
+    }
+    const uint64_t head = buffer->head.load(std::memory_order_acquire);
+    const uint64_t count = std::min<uint64_t>(head, kBufferSize);
+    for (uint64_t i = head - count; i < head; i++) {
+      const Event& event = buffer->events[i % kBufferSize];
+      thread_events[event.tid].push_back(event);
+    }
+  }
+  std::vector<ThreadTrace> traces;
+  traces.reserve(thread_events.size());
+  for (auto& [tid, events] : thread_events) {
+    traces.push_back({tid, std::move(events)});
+  }
+  return traces;
+}
+
+static std::string escapeJson(const char* str)
+{
+  std::string escaped;
+  for (const char* c = str; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      escaped += '\\';
+    }
+    escaped += *c;
+  }
+  return escaped;
+}
+
+std::size_t Tracer::writeChromeTrace(std::ostream& out)
+{
+  std::size_t count = 0;
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  const char* sep = "\n";
+  for (const ThreadTrace& trace : getTraces()) {
+    out << sep
+        << fmt::format(
+               R"({{"name": "thread_name", "ph": "M", "pid": 1, "tid": {}, )"
+               R"("args": {{"name": "thread {}"}}}})",
+               trace.tid,
+               trace.tid);
+    sep = ",\n";
+    for (const Event& event : trace.events) {
+      out << sep
+          << fmt::format(
+                 R"({{"name": "{}", "cat": "{}", "ph": "X", "pid": 1, )"
+                 R"("tid": {}, "ts": {:.3f}, "dur": {:.3f}, )"
+                 R"("args": {{"depth": {}}}}})",
+                 escapeJson(event.name),
+                 escapeJson(event.category),
+                 trace.tid,
+                 event.start_ns / 1e3,
+                 event.duration_ns / 1e3,
+                 event.depth);
+      count++;
+    }
+  }
+  out << "\n]}\n";
+  return count;
+}
+
+void Tracer::writeChromeTrace(const std::string& filename, Logger* logger)
+{
+  std::ofstream out(filename);
+  if (!out) {
+    logger->error(UTL, 109, "Unable to open trace file {}.", filename);
+  }
+  const std::size_t count = writeChromeTrace(out);
+  logger->info(UTL, 110, "Wrote {} trace zones to {}.", count, filename);
+}
+
+//////////////////////////
+
+void TraceZone::begin(const char* name, const char* category)
+{
+  Tracer& tracer = Tracer::get();
+  buffer_ = tracer.threadBuffer();
+  name_ = name;
+  category_ = category;
+  trace_ = tracer.trace_.load(std::memory_order_acquire);
+  depth_ = buffer_->depth++;
+  start_ns_ = tracer.now();
+}
+
+void TraceZone::end()
+{
+  buffer_->depth--;
+  Tracer::get().record(buffer_, name_, category_, trace_, start_ns_, depth_);
+  buffer_ = nullptr;
+}
+
+}  // namespace utl
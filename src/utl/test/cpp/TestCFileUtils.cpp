@@ -279,4 +279,23 @@ TEST(Utl, metrics_server_responds_with_basic_metric)
   EXPECT_THAT(response, HasSubstr("10101"));
 }
 
+TEST(Utl, metrics_server_reports_process_metrics)
+{
+  Logger logger;
+  logger.setMetricsStage("floorplan__{}");
+  logger.startPrometheusEndpoint(0);
+
+  std::time_t t = std::time(nullptr);
+  while (!logger.isPrometheusServerReadyToServe()) {
+    ASSERT_LT((std::time(nullptr) - t), 10);
+  }
+
+  uint16_t port = logger.getPrometheusPort();
+  std::string response
+      = MakeHttpRequest("localhost", fmt::format("{}", port), "/metrics");
+  EXPECT_THAT(response, HasSubstr("ord_resident_memory_bytes"));
+  EXPECT_THAT(response, HasSubstr("ord_cpu_seconds"));
+  EXPECT_THAT(response, HasSubstr("stage=\"floorplan\""));
+}
+
 }  // namespace utl
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utl/tracer.h"
+
+namespace utl {
+namespace {
+
+std::size_t countEvents(const std::vector<Tracer::ThreadTrace>& traces)
+{
+  std::size_t count = 0;
+  for (const auto& trace : traces) {
+    count += trace.events.size();
+  }
+  return count;
+}
+
+TEST(TracerTest, DisabledRecordsNothing)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  tracer.stop();
+  {
+    TraceZone zone("ignored");
+  }
+  EXPECT_EQ(countEvents(tracer.getTraces()), 0);
+}
+
+TEST(TracerTest, NestedZones)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  {
+    TraceZone outer("outer", "test");
+    {
+      TraceZone inner("inner", "test");
+    }
+    TraceZone early("early", "test");
+    early.done();
+  }
+  tracer.stop();
+
+  const auto traces = tracer.getTraces();
+  ASSERT_EQ(traces.size(), 1);
+  const auto& events = traces[0].events;
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_STREQ(events[0].name, "inner");
+  EXPECT_EQ(events[0].depth, 1);
+  EXPECT_STREQ(events[1].name, "early");
+  EXPECT_EQ(events[1].depth, 1);
+  EXPECT_STREQ(events[2].name, "outer");
+  EXPECT_EQ(events[2].depth, 0);
+  EXPECT_LE(events[2].start_ns, events[0].start_ns);
+  EXPECT_GE(events[2].duration_ns, events[0].duration_ns);
+}
+
+TEST(TracerTest, PerThreadBuffers)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 100; j++) {
+        TraceZone zone("work", "test");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  tracer.stop();
+
+  const auto traces = tracer.getTraces();
+  EXPECT_EQ(traces.size(), 4);
+  EXPECT_EQ(countEvents(traces), 400);
+}
+
+TEST(TracerTest, ReusedBuffersKeepThreadIds)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  // Each thread exits before the next one starts, so they share a buffer.
+  for (int i = 0; i < 3; i++) {
+    std::thread([] { TraceZone zone("work", "test"); }).join();
+  }
+  tracer.stop();
+
+  const auto traces = tracer.getTraces();
+  ASSERT_EQ(traces.size(), 3);
+  for (const auto& trace : traces) {
+    ASSERT_EQ(trace.events.size(), 1);
+    EXPECT_EQ(trace.events[0].tid, trace.tid);
+  }
+}
+
+TEST(TracerTest, RestartDropsOpenZones)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  {
+    TraceZone stale("stale", "test");
+    {
+      TraceZone old("old", "test");
+    }
+    tracer.start();
+    TraceZone fresh("fresh", "test");
+    fresh.done();
+  }
+  tracer.stop();
+
+  const auto traces = tracer.getTraces();
+  ASSERT_EQ(traces.size(), 1);
+  ASSERT_EQ(traces[0].events.size(), 1);
+  EXPECT_STREQ(traces[0].events[0].name, "fresh");
+}
+
+TEST(TracerTest, RestartWhileThreadsRecord)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  std::atomic<bool> done = false;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&done] {
+      while (!done) {
+        TraceZone zone("work", "test");
+      }
+    });
+  }
+  for (int i = 0; i < 100; i++) {
+    tracer.start();
+  }
+  tracer.stop();
+  done = true;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Only zones that began in the last trace may be reported.
+  for (const auto& trace : tracer.getTraces()) {
+    for (const auto& event : trace.events) {
+      EXPECT_GE(event.start_ns, 0);
+      EXPECT_EQ(event.tid, trace.tid);
+    }
+  }
+}
+
+TEST(TracerTest, ChromeTraceJson)
+{
+  Tracer& tracer = Tracer::get();
+  tracer.start();
+  {
+    TraceZone zone("phase \"one\"", "test");
+  }
+  tracer.stop();
+
+  std::ostringstream out;
+  EXPECT_EQ(tracer.writeChromeTrace(out), 1);
+  const std::string json = out.str();
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find(R"("name": "phase \"one\"")"), std::string::npos);
+  EXPECT_NE(json.find(R"("ph": "X")"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace utl